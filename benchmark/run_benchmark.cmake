@@ -0,0 +1,182 @@
+# Copyright 2026 The Boost.Endian Authors
+# Distributed under the Boost Software License, Version 1.0.
+# See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt
+
+# Runs a benchmark that prints its results as JSON,
+#
+#   { "iterations": N, "results": { "name": time, ... }, "ratios": { "name": percent, ... }, ... }
+#
+# with the ratios, of each time to that of a reference measured in the same
+# run, as integers. The benchmark is run RUNS times, and the smallest ratio of
+# each case is compared against BASELINE, with the tolerance recorded for the
+# case there. When BASELINE doesn't exist, the comparison is skipped, with a
+# message starting with "No baseline".
+#
+# Usage: cmake -DBENCHMARK=<exe> -DITERATIONS=<n> -DRUNS=<n> -DTOLERANCE=<percent>
+#              -DBASELINE=<json> -DOUTPUT=<json> [-DUPDATE=ON] -P run_benchmark.cmake
+#
+# With UPDATE, the baseline is written instead; this is the only way it is
+# recorded. The measurement above is repeated RUNS times. The baseline ratio
+# of each case is the median of the repetitions, and its tolerance is
+# TOLERANCE plus three times their spread, as a percentage of the median, so
+# that a case whose best ratio varies more is allowed to vary more.
+
+cmake_minimum_required(VERSION 3.19)
+
+if(NOT RUNS GREATER 0)
+  set(RUNS 1)
+endif()
+
+# Runs the benchmark RUNS times, and stores the results of the first run,
+# with the smallest ratio of each case over all runs, in `results`. A
+# slowdown must show in every run to count, so that a single disturbed run
+# can't fail the test.
+
+function(measure results)
+
+  foreach(run RANGE 1 ${RUNS})
+
+    execute_process(COMMAND ${BENCHMARK} ${ITERATIONS} OUTPUT_VARIABLE output RESULT_VARIABLE status)
+
+    if(NOT status EQUAL 0)
+      message(FATAL_ERROR "${BENCHMARK} failed: ${status}")
+    endif()
+
+    if(run EQUAL 1)
+
+      set(best "${output}")
+
+    else()
+
+      string(JSON count LENGTH "${best}" ratios)
+      math(EXPR last "${count} - 1")
+
+      foreach(i RANGE ${last})
+
+        string(JSON name MEMBER "${best}" ratios ${i})
+        string(JSON current GET "${best}" ratios ${name})
+        string(JSON ratio GET "${output}" ratios ${name})
+
+        if(ratio LESS current)
+          string(JSON best SET "${best}" ratios ${name} ${ratio})
+        endif()
+
+      endforeach()
+
+    endif()
+
+  endforeach()
+
+  set(${results} "${best}" PARENT_SCOPE)
+
+endfunction()
+
+if(UPDATE)
+
+  foreach(k RANGE 1 ${RUNS})
+
+    measure(output)
+
+    if(k EQUAL 1)
+      set(results "${output}")
+      string(JSON results SET "${results}" tolerances "{}")
+    endif()
+
+    string(JSON count LENGTH "${results}" ratios)
+    math(EXPR last "${count} - 1")
+
+    foreach(i RANGE ${last})
+
+      string(JSON name MEMBER "${results}" ratios ${i})
+      string(JSON ratio GET "${output}" ratios ${name})
+
+      list(APPEND ratios_${name} ${ratio})
+
+    endforeach()
+
+  endforeach()
+
+  math(EXPR middle "${RUNS} / 2")
+  math(EXPR top "${RUNS} - 1")
+
+  foreach(i RANGE ${last})
+
+    string(JSON name MEMBER "${results}" ratios ${i})
+
+    list(SORT ratios_${name} COMPARE NATURAL)
+
+    list(GET ratios_${name} 0 smallest)
+    list(GET ratios_${name} ${middle} median)
+    list(GET ratios_${name} ${top} largest)
+
+    math(EXPR tolerance "${TOLERANCE} + 300 * (${largest} - ${smallest}) / ${median}")
+
+    string(JSON results SET "${results}" ratios ${name} ${median})
+    string(JSON results SET "${results}" tolerances ${name} ${tolerance})
+
+  endforeach()
+
+  file(WRITE ${OUTPUT} "${results}")
+  file(WRITE ${BASELINE} "${results}")
+
+  message(STATUS "Recorded the baseline ${BASELINE}")
+  return()
+
+endif()
+
+measure(results)
+
+file(WRITE ${OUTPUT} "${results}")
+
+if(NOT EXISTS ${BASELINE})
+  message("No baseline ${BASELINE} for this compiler and processor; the results are in ${OUTPUT}. Build the target endian_benchmark_baseline to record it.")
+  return()
+endif()
+
+file(READ ${BASELINE} baseline)
+
+string(JSON count ERROR_VARIABLE error LENGTH "${baseline}" ratios)
+
+if(error)
+  message(FATAL_ERROR "Baseline ${BASELINE} has no ratios; record it again")
+endif()
+
+math(EXPR last "${count} - 1")
+
+set(failures 0)
+
+foreach(i RANGE ${last})
+
+  string(JSON name MEMBER "${baseline}" ratios ${i})
+  string(JSON expected GET "${baseline}" ratios ${name})
+  string(JSON actual ERROR_VARIABLE error GET "${results}" ratios ${name})
+
+  string(JSON tolerance ERROR_VARIABLE missing GET "${baseline}" tolerances ${name})
+
+  if(missing)
+    set(tolerance ${TOLERANCE})
+  endif()
+
+  if(error)
+
+    message("  ${name}: missing from the results")
+    math(EXPR failures "${failures} + 1")
+
+  else()
+
+    math(EXPR limit "${expected} * (100 + ${tolerance}) / 100")
+
+    if(actual GREATER limit)
+      message("  ${name}: ${actual}%, baseline ${expected}%, limit ${limit}%: FAILED")
+      math(EXPR failures "${failures} + 1")
+    else()
+      message("  ${name}: ${actual}%, baseline ${expected}%, limit ${limit}%")
+    endif()
+
+  endif()
+
+endforeach()
+
+if(failures GREATER 0)
+  message(FATAL_ERROR "${failures} of ${count} benchmark cases are slower than their baseline by more than its tolerance")
+endif()
@@ -0,0 +1,445 @@
+#ifndef BOOST_ENDIAN_ARCHIVE_HPP_INCLUDED
+#define BOOST_ENDIAN_ARCHIVE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/endian_bulk.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  Arithmetic and enumeration types are written as sizeof(T) bytes in byte
+//  order Order, bool as one byte, and sizes as 64-bit unsigned integers.
+//  Contiguous arrays of arithmetic and enumeration types (std::vector,
+//  std::array, std::basic_string, built-in arrays) are converted with a single
+//  call to endian_store_n/endian_load_n. Class types are written by their
+//  member function serialize( Archive& ), or by a function serialize( Archive&,
+//  T& ) found by argument dependent lookup.
+
+namespace boost
+{
+namespace endian
+{
+
+  //  appends to a std::vector<unsigned char>
+  template<order Order> class binary_oarchive;
+
+  //  reads from [p, p + n); reading past the end yields zero values and sets overrun()
+  template<order Order> class binary_iarchive;
+
+  typedef binary_oarchive<order::big>       big_binary_oarchive;
+  typedef binary_oarchive<order::little>    little_binary_oarchive;
+  typedef binary_iarchive<order::big>       big_binary_iarchive;
+  typedef binary_iarchive<order::little>    little_binary_iarchive;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// types written as sizeof(T) bytes by endian_store and, in arrays, by endian_store_n
+
+template<class T> struct is_archive_scalar: std::integral_constant<bool,
+    ( std::is_integral<T>::value && !std::is_same<T, bool>::value ) || std::is_enum<T>::value ||
+    ( std::is_floating_point<T>::value && ( sizeof(T) == 4 || sizeof(T) == 8 ) )>
+{
+};
+
+// the default serialize calls the member function; overloads found by
+// argument dependent lookup take precedence
+
+template<class Archive, class T> inline void serialize( Archive & ar, T & v )
+{
+    v.serialize( ar );
+}
+
+template<class Archive, class T> inline void archive_serialize( Archive & ar, T & v )
+{
+    serialize( ar, v );
+}
+
+} // namespace detail
+
+//  binary_oarchive  -------------------------------------------------------------------//
+
+template<order Order> class binary_oarchive
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( Order == order::big || Order == order::little );
+
+    std::vector<unsigned char> & out_;
+
+private:
+
+    // n > 0
+
+    unsigned char * grow( std::size_t n )
+    {
+        std::size_t const k = out_.size();
+        out_.resize( k + n );
+
+        return out_.data() + k;
+    }
+
+    void save_size( std::size_t n )
+    {
+        boost::endian::endian_store<std::uint64_t, 8, Order>( grow( 8 ), static_cast<std::uint64_t>( n ) );
+    }
+
+    template<class T> void save_range( T const * p, std::size_t n, std::true_type )
+    {
+        if( n == 0 ) return;
+        boost::endian::endian_store_n<T, Order>( p, n, grow( n * sizeof(T) ) );
+    }
+
+    template<class T> void save_range( T const * p, std::size_t n, std::false_type )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            save( p[ i ] );
+        }
+    }
+
+    template<class T> void save_range( T const * p, std::size_t n )
+    {
+        save_range( p, n, detail::is_archive_scalar<T>() );
+    }
+
+    template<class T> void save( T const & v, std::true_type )
+    {
+        boost::endian::endian_store<T, sizeof(T), Order>( grow( sizeof(T) ), v );
+    }
+
+    template<class T> void save( T const & v, std::false_type )
+    {
+        detail::archive_serialize( *this, const_cast<T&>( v ) );
+    }
+
+    template<class T> void save( T const & v )
+    {
+        save( v, detail::is_archive_scalar<T>() );
+    }
+
+    void save( bool v )
+    {
+        *grow( 1 ) = v;
+    }
+
+    template<class T, class A> void save( std::vector<T, A> const & v )
+    {
+        save_size( v.size() );
+        save_range( v.data(), v.size() );
+    }
+
+    // std::vector<bool> has no data(); its elements are written as bool,
+    // one byte each
+
+    template<class A> void save( std::vector<bool, A> const & v )
+    {
+        std::size_t const n = v.size();
+
+        save_size( n );
+
+        if( n == 0 ) return;
+
+        unsigned char * p = grow( n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            p[ i ] = v[ i ];
+        }
+    }
+
+    template<class Ch, class Tr, class A> void save( std::basic_string<Ch, Tr, A> const & v )
+    {
+        save_size( v.size() );
+        save_range( v.data(), v.size() );
+    }
+
+    template<class T, std::size_t N> void save( std::array<T, N> const & v )
+    {
+        save_range( v.data(), N );
+    }
+
+    template<class T, std::size_t N> void save( T const (&v)[ N ] )
+    {
+        save_range( v, N );
+    }
+
+public:
+
+    typedef std::true_type is_saving;
+    typedef std::false_type is_loading;
+
+    explicit binary_oarchive( std::vector<unsigned char> & out ) BOOST_NOEXCEPT: out_( out )
+    {
+    }
+
+    template<class T> binary_oarchive& operator&( T const & v )
+    {
+        save( v );
+        return *this;
+    }
+
+    template<class T> binary_oarchive& operator<<( T const & v )
+    {
+        save( v );
+        return *this;
+    }
+};
+
+//  binary_iarchive  -------------------------------------------------------------------//
+
+template<order Order> class binary_iarchive
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( Order == order::big || Order == order::little );
+
+    unsigned char const * next_;
+    unsigned char const * end_;
+
+    bool overrun_;
+
+private:
+
+    void fail() BOOST_NOEXCEPT
+    {
+        next_ = end_;
+        overrun_ = true;
+    }
+
+    // Returns: a pointer to the next n bytes, or 0 when fewer remain
+
+    unsigned char const * take( std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( remaining() < n )
+        {
+            fail();
+            return 0;
+        }
+
+        unsigned char const * p = next_;
+        next_ += n;
+
+        return p;
+    }
+
+    // Returns: a size of at most m elements, or 0 after setting overrun()
+
+    std::size_t load_size( std::size_t m ) BOOST_NOEXCEPT
+    {
+        unsigned char const * p = take( 8 );
+
+        if( p == 0 ) return 0;
+
+        std::uint64_t n = boost::endian::endian_load<std::uint64_t, 8, Order>( p );
+
+        if( n > m )
+        {
+            fail();
+            return 0;
+        }
+
+        return static_cast<std::size_t>( n );
+    }
+
+    // the largest size that the remaining input can hold
+
+    template<class T> std::size_t max_size( std::true_type ) const BOOST_NOEXCEPT
+    {
+        return remaining() / sizeof(T);
+    }
+
+    template<class T> std::size_t max_size( std::false_type ) const BOOST_NOEXCEPT
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    template<class T> std::size_t load_size_of() BOOST_NOEXCEPT
+    {
+        return load_size( max_size<T>( detail::is_archive_scalar<T>() ) );
+    }
+
+    template<class T> void load_range( T * p, std::size_t n, std::true_type )
+    {
+        unsigned char const * q = take( n * sizeof(T) );
+
+        if( q == 0 )
+        {
+            for( std::size_t i = 0; i < n; ++i ) p[ i ] = T();
+            return;
+        }
+
+        if( n == 0 ) return;
+        boost::endian::endian_load_n<T, Order>( q, n, p );
+    }
+
+    template<class T> void load_range( T * p, std::size_t n, std::false_type )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            load( p[ i ] );
+        }
+    }
+
+    template<class T> void load_range( T * p, std::size_t n )
+    {
+        load_range( p, n, detail::is_archive_scalar<T>() );
+    }
+
+    template<class T> void load( T & v, std::true_type ) BOOST_NOEXCEPT
+    {
+        unsigned char const * p = take( sizeof(T) );
+        v = p? boost::endian::endian_load<T, sizeof(T), Order>( p ): T();
+    }
+
+    template<class T> void load( T & v, std::false_type )
+    {
+        detail::archive_serialize( *this, v );
+    }
+
+    template<class T> void load( T & v )
+    {
+        load( v, detail::is_archive_scalar<T>() );
+    }
+
+    void load( bool & v ) BOOST_NOEXCEPT
+    {
+        unsigned char const * p = take( 1 );
+        v = p && *p != 0;
+    }
+
+    template<class T, class A> void load( std::vector<T, A> & v, std::true_type )
+    {
+        std::size_t n = load_size_of<T>();
+
+        v.resize( n );
+        load_range( v.data(), n );
+    }
+
+    // the elements are read one at a time, so that a corrupted size fails
+    // at the end of the input rather than in the allocation
+
+    template<class T, class A> void load( std::vector<T, A> & v, std::false_type )
+    {
+        std::size_t n = load_size_of<T>();
+
+        v.clear();
+
+        for( std::size_t i = 0; i < n && !overrun_; ++i )
+        {
+            v.emplace_back();
+            load( v.back() );
+        }
+    }
+
+    template<class T, class A> void load( std::vector<T, A> & v )
+    {
+        load( v, detail::is_archive_scalar<T>() );
+    }
+
+    template<class A> void load( std::vector<bool, A> & v )
+    {
+        std::size_t n = load_size( remaining() );
+        unsigned char const * p = take( n );
+
+        if( p == 0 )
+        {
+            v.clear();
+            return;
+        }
+
+        v.resize( n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            v[ i ] = p[ i ] != 0;
+        }
+    }
+
+    template<class Ch, class Tr, class A> void load( std::basic_string<Ch, Tr, A> & v )
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_archive_scalar<Ch>::value );
+
+        std::size_t n = load_size_of<Ch>();
+
+        v.resize( n );
+
+        if( n != 0 )
+        {
+            load_range( &v[ 0 ], n );
+        }
+    }
+
+    template<class T, std::size_t N> void load( std::array<T, N> & v )
+    {
+        load_range( v.data(), N );
+    }
+
+    template<class T, std::size_t N> void load( T (&v)[ N ] )
+    {
+        load_range( v, N );
+    }
+
+public:
+
+    typedef std::false_type is_saving;
+    typedef std::true_type is_loading;
+
+    binary_iarchive( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT:
+        next_( p ), end_( p + n ), overrun_( false )
+    {
+    }
+
+    template<class T> binary_iarchive& operator&( T & v )
+    {
+        load( v );
+        return *this;
+    }
+
+    template<class T> binary_iarchive& operator>>( T & v )
+    {
+        load( v );
+        return *this;
+    }
+
+    //  Returns: the number of bytes not yet read
+
+    std::size_t remaining() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( end_ - next_ );
+    }
+
+    bool overrun() const BOOST_NOEXCEPT
+    {
+        return overrun_;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_ARCHIVE_HPP_INCLUDED
@@ -28,9 +28,14 @@
 #endif
 
 #include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/integral_by_size.hpp>
+#include <boost/endian/detail/integer_literal.hpp>
+#include <boost/endian/detail/is_constant_evaluated.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <boost/config.hpp>
+#include <type_traits>
 #include <cstdint>
+#include <cstring>
 #include <iosfwd>
 #include <climits>
 
@@ -160,8 +165,85 @@ namespace endian
   typedef endian_arithmetic<order::native, float, 32, align::no>     native_float32_t;
   typedef endian_arithmetic<order::native, double, 64, align::no>    native_float64_t;
 
+  //  When T is integral, &=, |= and ^= operate on the stored bytes, with the
+  //  operand converted to the byte order of the object, and == and != against
+  //  an integral value or an object of the same type compare the stored bytes.
+
+  //  literals of the unaligned unsigned types: 0xCAFEBABE_be32 is
+  //  big_uint32_t( 0xCAFEBABE ); a value that doesn't fit is ill-formed
+  namespace literals
+  {
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR big_uint16_t operator""_be16() BOOST_NOEXCEPT;
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR big_uint32_t operator""_be32() BOOST_NOEXCEPT;
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR big_uint64_t operator""_be64() BOOST_NOEXCEPT;
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR little_uint16_t operator""_le16() BOOST_NOEXCEPT;
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR little_uint32_t operator""_le32() BOOST_NOEXCEPT;
+    template<char... C> BOOST_ENDIAN_CXX20_CONSTEXPR little_uint64_t operator""_le64() BOOST_NOEXCEPT;
+  }
+
 //----------------------------------  end synopsis  ------------------------------------//
 
+namespace detail
+{
+
+// Bitwise operations and equality commute with the byte order conversion,
+// so they can be applied to the stored bytes. N bytes are processed as one
+// word when N is a word size.
+
+struct encoded_and
+{
+    template<class U> U operator()( U x, U y ) const BOOST_NOEXCEPT
+    {
+        return static_cast<U>( x & y );
+    }
+};
+
+struct encoded_or
+{
+    template<class U> U operator()( U x, U y ) const BOOST_NOEXCEPT
+    {
+        return static_cast<U>( x | y );
+    }
+};
+
+struct encoded_xor
+{
+    template<class U> U operator()( U x, U y ) const BOOST_NOEXCEPT
+    {
+        return static_cast<U>( x ^ y );
+    }
+};
+
+template<std::size_t N, bool W = N == 1 || N == 2 || N == 4 || N == 8> struct encoded_bitwise
+{
+    template<class Op> static void apply( unsigned char * p, unsigned char const * q, Op op ) BOOST_NOEXCEPT
+    {
+        typedef typename integral_by_size<N>::type U;
+
+        U x, y;
+
+        std::memcpy( &x, p, N );
+        std::memcpy( &y, q, N );
+
+        x = op( x, y );
+
+        std::memcpy( p, &x, N );
+    }
+};
+
+template<std::size_t N> struct encoded_bitwise<N, false>
+{
+    template<class Op> static void apply( unsigned char * p, unsigned char const * q, Op op ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            p[ i ] = op( p[ i ], q[ i ] );
+        }
+    }
+};
+
+} // namespace detail
+
 template <order Order, class T, std::size_t n_bits,
     align Align>
 class endian_arithmetic
@@ -178,6 +260,50 @@ private:
 
     buffer_type buf_;
 
+private:
+
+    static buffer_type encode( T v ) BOOST_NOEXCEPT
+    {
+        buffer_type r;
+        r = v;
+
+        return r;
+    }
+
+    template<class Op> endian_arithmetic& apply_encoded( buffer_type const& y, Op op ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+        detail::encoded_bitwise<n_bits / 8>::apply( buf_.data(), y.data(), op );
+        return *this;
+    }
+
+    // value() == y, without converting *this
+
+    template<class U> bool equals( U y, std::true_type ) const BOOST_NOEXCEPT
+    {
+        T const v = static_cast<T>( y );
+
+        // y is not a value of T, as compared by value() == y
+
+        typedef decltype( v + y ) C;
+
+        if( static_cast<C>( v ) != static_cast<C>( y ) ) return false;
+
+        buffer_type const e = encode( v );
+
+        // v is not representable in n_bits
+
+        if( n_bits < sizeof(T) * 8 && e.value() != v ) return false;
+
+        return std::memcmp( buf_.data(), e.data(), n_bits / 8 ) == 0;
+    }
+
+    template<class U> bool equals( U y, std::false_type ) const BOOST_NOEXCEPT
+    {
+        return this->value() == y;
+    }
+
 public:
 
     typedef T value_type;
@@ -186,19 +312,19 @@ public:
 
     endian_arithmetic() = default;
 
-    BOOST_ENDIAN_EXPLICIT_OPT endian_arithmetic( T val ) BOOST_NOEXCEPT: buf_( val )
+    BOOST_ENDIAN_CXX20_CONSTEXPR BOOST_ENDIAN_EXPLICIT_OPT endian_arithmetic( T val ) BOOST_NOEXCEPT: buf_( val )
     {
     }
 
 #endif
 
-    endian_arithmetic& operator=( T val ) BOOST_NOEXCEPT
+    BOOST_ENDIAN_CXX20_CONSTEXPR endian_arithmetic& operator=( T val ) BOOST_NOEXCEPT
     {
         buf_ = val;
         return *this;
     }
 
-    value_type value() const BOOST_NOEXCEPT
+    BOOST_ENDIAN_CXX20_CONSTEXPR value_type value() const BOOST_NOEXCEPT
     {
         return buf_.value();
     }
@@ -265,22 +391,37 @@ public:
         return *this;
     }
 
+    // the bitwise operators convert y instead of *this; when y is a
+    // constant, the conversion is performed at compile time
+
     endian_arithmetic& operator&=( T y ) BOOST_NOEXCEPT
     {
-        *this = static_cast<T>( this->value() & y );
-        return *this;
+        return this->apply_encoded( encode( y ), detail::encoded_and() );
     }
 
     endian_arithmetic& operator|=( T y ) BOOST_NOEXCEPT
     {
-        *this = static_cast<T>( this->value() | y );
-        return *this;
+        return this->apply_encoded( encode( y ), detail::encoded_or() );
     }
 
     endian_arithmetic& operator^=( T y ) BOOST_NOEXCEPT
     {
-        *this = static_cast<T>( this->value() ^ y );
-        return *this;
+        return this->apply_encoded( encode( y ), detail::encoded_xor() );
+    }
+
+    endian_arithmetic& operator&=( endian_arithmetic const& y ) BOOST_NOEXCEPT
+    {
+        return this->apply_encoded( y.buf_, detail::encoded_and() );
+    }
+
+    endian_arithmetic& operator|=( endian_arithmetic const& y ) BOOST_NOEXCEPT
+    {
+        return this->apply_encoded( y.buf_, detail::encoded_or() );
+    }
+
+    endian_arithmetic& operator^=( endian_arithmetic const& y ) BOOST_NOEXCEPT
+    {
+        return this->apply_encoded( y.buf_, detail::encoded_xor() );
     }
 
     endian_arithmetic& operator<<=( T y ) BOOST_NOEXCEPT
@@ -321,6 +462,52 @@ public:
         return tmp;
     }
 
+    // comparisons; the integral operand is converted, as above. They
+    // return the same results as the comparisons of value(), which are
+    // used when T is a floating point type
+
+    template<class U>
+    friend typename std::enable_if<std::is_integral<U>::value, bool>::type
+    operator==( endian_arithmetic const& x, U y ) BOOST_NOEXCEPT
+    {
+        return x.equals( y, std::is_integral<T>() );
+    }
+
+    template<class U>
+    friend typename std::enable_if<std::is_integral<U>::value, bool>::type
+    operator==( U x, endian_arithmetic const& y ) BOOST_NOEXCEPT
+    {
+        return y.equals( x, std::is_integral<T>() );
+    }
+
+    template<class U>
+    friend typename std::enable_if<std::is_integral<U>::value, bool>::type
+    operator!=( endian_arithmetic const& x, U y ) BOOST_NOEXCEPT
+    {
+        return !x.equals( y, std::is_integral<T>() );
+    }
+
+    template<class U>
+    friend typename std::enable_if<std::is_integral<U>::value, bool>::type
+    operator!=( U x, endian_arithmetic const& y ) BOOST_NOEXCEPT
+    {
+        return !y.equals( x, std::is_integral<T>() );
+    }
+
+    template<class E>
+    friend typename std::enable_if<std::is_same<E, endian_arithmetic>::value && std::is_integral<T>::value, bool>::type
+    operator==( endian_arithmetic const& x, E const& y ) BOOST_NOEXCEPT
+    {
+        return std::memcmp( x.data(), y.data(), n_bits / 8 ) == 0;
+    }
+
+    template<class E>
+    friend typename std::enable_if<std::is_same<E, endian_arithmetic>::value && std::is_integral<T>::value, bool>::type
+    operator!=( endian_arithmetic const& x, E const& y ) BOOST_NOEXCEPT
+    {
+        return std::memcmp( x.data(), y.data(), n_bits / 8 ) != 0;
+    }
+
     template<class Ch, class Tr>
     friend std::basic_ostream<Ch, Tr>&
     operator<<( std::basic_ostream<Ch, Tr>& os, endian_arithmetic const& x )
@@ -343,6 +530,71 @@ public:
     }
 };
 
+namespace literals
+{
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR big_uint16_t operator""_be16() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<16, C...>::value );
+
+    big_uint16_t r;
+    r = static_cast<std::uint_least16_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR big_uint32_t operator""_be32() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<32, C...>::value );
+
+    big_uint32_t r;
+    r = static_cast<std::uint_least32_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR big_uint64_t operator""_be64() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<64, C...>::value );
+
+    big_uint64_t r;
+    r = static_cast<std::uint_least64_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR little_uint16_t operator""_le16() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<16, C...>::value );
+
+    little_uint16_t r;
+    r = static_cast<std::uint_least16_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR little_uint32_t operator""_le32() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<32, C...>::value );
+
+    little_uint32_t r;
+    r = static_cast<std::uint_least32_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+template<char... C> inline BOOST_ENDIAN_CXX20_CONSTEXPR little_uint64_t operator""_le64() BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::integer_literal_fits<64, C...>::value );
+
+    little_uint64_t r;
+    r = static_cast<std::uint_least64_t>( detail::integer_literal<C...>::value );
+
+    return r;
+}
+
+} // namespace literals
+
 } // namespace endian
 } // namespace boost
 
@@ -0,0 +1,578 @@
+#ifndef BOOST_ENDIAN_BIT_STREAM_HPP_INCLUDED
+#define BOOST_ENDIAN_BIT_STREAM_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  Bit order follows byte order: with order::big, fields are packed MSB-first
+//  (MPEG-TS, H.264); with order::little, fields are packed LSB-first (CAN,
+//  DEFLATE). Fields are at most 64 bits wide.
+
+namespace boost
+{
+namespace endian
+{
+
+  template<order Order> class bit_reader;
+  template<order Order> class bit_writer;
+
+  typedef bit_reader<order::big>        big_bit_reader;
+  typedef bit_reader<order::little>     little_bit_reader;
+  typedef bit_writer<order::big>        big_bit_writer;
+  typedef bit_writer<order::little>     little_bit_writer;
+
+  //  a field of Width bits starting Offset bits into a byte sequence;
+  //  Offset % 8 + Width must not exceed 64
+  template<std::size_t Offset, std::size_t Width, order Order = order::big,
+    class T = std::uint64_t>
+      struct bit_field;
+
+  //  consecutive fields of the given widths, the first at bit offset 0
+  template<order Order, std::size_t... Widths>
+    struct bit_layout;
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace detail
+{
+
+inline std::uint64_t bit_mask( unsigned n ) BOOST_NOEXCEPT
+{
+    return n >= 64? ~static_cast<std::uint64_t>( 0 ): ( static_cast<std::uint64_t>( 1 ) << n ) - 1;
+}
+
+template<class T> inline T bit_extend( std::uint64_t v, unsigned n, std::false_type ) BOOST_NOEXCEPT
+{
+    (void)n;
+    return static_cast<T>( v );
+}
+
+template<class T> inline T bit_extend( std::uint64_t v, unsigned n, std::true_type ) BOOST_NOEXCEPT
+{
+    std::uint64_t const m = static_cast<std::uint64_t>( 1 ) << ( n - 1 );
+    return static_cast<T>( static_cast<std::int64_t>( ( v ^ m ) - m ) );
+}
+
+} // namespace detail
+
+//  bit_reader  ------------------------------------------------------------------------//
+
+//  Keeps up to 64 bits in a cache that is refilled with a single unaligned
+//  load_big_u64/load_little_u64 while at least 8 bytes remain; bytes are only
+//  fetched one at a time at the very end of the input. Reading past the end
+//  yields zero bits and sets overrun().
+
+template<order Order> class bit_reader
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( Order == order::big || Order == order::little );
+
+    unsigned char const * next_;
+    unsigned char const * end_;
+
+    std::uint64_t cache_;
+    unsigned count_;
+
+    std::size_t pos_;
+    std::size_t size_;
+
+private:
+
+    // ensures count_ >= 56
+
+    void refill() BOOST_NOEXCEPT
+    {
+        if( end_ - next_ >= 8 )
+        {
+            // the bits below the valid ones are always either zero or the correct
+            // next bits of the stream, so overlapping loads are harmless
+
+            if( Order == order::big )
+            {
+                cache_ |= boost::endian::load_big_u64( next_ ) >> count_;
+            }
+            else
+            {
+                cache_ |= boost::endian::load_little_u64( next_ ) << count_;
+            }
+
+            next_ += ( 63 - count_ ) >> 3;
+            count_ |= 56;
+        }
+        else
+        {
+            while( count_ <= 56 )
+            {
+                std::uint64_t b = next_ < end_? *next_++: 0;
+
+                if( Order == order::big )
+                {
+                    cache_ |= b << ( 56 - count_ );
+                }
+                else
+                {
+                    cache_ |= b << count_;
+                }
+
+                count_ += 8;
+            }
+        }
+    }
+
+    // 1 <= n <= 56, count_ >= n
+
+    std::uint64_t peek_bits( unsigned n ) const BOOST_NOEXCEPT
+    {
+        if( Order == order::big )
+        {
+            return cache_ >> ( 64 - n );
+        }
+        else
+        {
+            return cache_ & detail::bit_mask( n );
+        }
+    }
+
+    void consume( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( Order == order::big )
+        {
+            cache_ <<= n;
+        }
+        else
+        {
+            cache_ >>= n;
+        }
+
+        count_ -= n;
+        pos_ += n;
+    }
+
+    std::uint64_t get_bits( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( count_ < n ) refill();
+
+        std::uint64_t r = peek_bits( n );
+        consume( n );
+
+        return r;
+    }
+
+public:
+
+    bit_reader( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT:
+        next_( p ), end_( p + n ), cache_( 0 ), count_( 0 ), pos_( 0 ), size_( n * 8 )
+    {
+    }
+
+    //  Requires: n <= 64
+    //  Returns: the next n bits of the stream, zero-extended
+
+    std::uint64_t read( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( n == 0 ) return 0;
+
+        if( n <= 56 ) return get_bits( n );
+
+        // read the more significant part first
+
+        if( Order == order::big )
+        {
+            std::uint64_t hi = get_bits( n - 32 );
+            return hi << 32 | get_bits( 32 );
+        }
+        else
+        {
+            std::uint64_t lo = get_bits( 32 );
+            return get_bits( n - 32 ) << 32 | lo;
+        }
+    }
+
+    //  Requires: 1 <= n <= 64
+    //  Returns: the next n bits of the stream, sign-extended
+
+    std::int64_t read_signed( unsigned n ) BOOST_NOEXCEPT
+    {
+        return detail::bit_extend<std::int64_t>( read( n ), n, std::true_type() );
+    }
+
+    bool read_bit() BOOST_NOEXCEPT
+    {
+        return get_bits( 1 ) != 0;
+    }
+
+    //  Requires: n <= 56
+    //  Returns: the next n bits of the stream, without consuming them
+
+    std::uint64_t peek( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( n == 0 ) return 0;
+        if( count_ < n ) refill();
+
+        return peek_bits( n );
+    }
+
+    void skip( std::size_t n ) BOOST_NOEXCEPT
+    {
+        // count_ can be 64 after a byte-wise refill, and consume(64) would
+        // shift by the full width of the cache
+
+        if( n < count_ )
+        {
+            consume( static_cast<unsigned>( n ) );
+            return;
+        }
+
+        n -= count_;
+        pos_ += count_;
+
+        cache_ = 0;
+        count_ = 0;
+
+        std::size_t const bytes = n / 8;
+        std::size_t const avail = static_cast<std::size_t>( end_ - next_ );
+
+        next_ += bytes < avail? bytes: avail;
+        pos_ += bytes * 8;
+
+        if( n % 8 != 0 )
+        {
+            get_bits( static_cast<unsigned>( n % 8 ) );
+        }
+    }
+
+    //  Skips to the next byte boundary
+
+    void align() BOOST_NOEXCEPT
+    {
+        skip( ( 8 - pos_ % 8 ) % 8 );
+    }
+
+    //  Returns: the number of bits consumed so far
+
+    std::size_t position() const BOOST_NOEXCEPT
+    {
+        return pos_;
+    }
+
+    std::size_t bits_left() const BOOST_NOEXCEPT
+    {
+        return pos_ < size_? size_ - pos_: 0;
+    }
+
+    bool overrun() const BOOST_NOEXCEPT
+    {
+        return pos_ > size_;
+    }
+};
+
+//  bit_writer  ------------------------------------------------------------------------//
+
+//  Accumulates bits in a 64-bit cache and flushes the whole bytes in it with a
+//  single store_big_u64/store_little_u64 while at least 8 bytes of room remain.
+//  Bits that do not fit in the output are dropped and set overflow().
+
+template<order Order> class bit_writer
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( Order == order::big || Order == order::little );
+
+    unsigned char * first_;
+    unsigned char * next_;
+    unsigned char * end_;
+
+    std::uint64_t cache_;
+    unsigned count_;
+
+    bool overflow_;
+
+private:
+
+    // writes the whole bytes in the cache; afterwards, count_ < 8
+
+    void flush_bytes() BOOST_NOEXCEPT
+    {
+        unsigned const bytes = count_ >> 3;
+
+        if( end_ - next_ >= 8 )
+        {
+            if( Order == order::big )
+            {
+                boost::endian::store_big_u64( next_, cache_ );
+            }
+            else
+            {
+                boost::endian::store_little_u64( next_, cache_ );
+            }
+
+            next_ += bytes;
+        }
+        else
+        {
+            for( unsigned i = 0; i < bytes; ++i )
+            {
+                unsigned char b = static_cast<unsigned char>( Order == order::big? cache_ >> ( 56 - 8 * i ): cache_ >> ( 8 * i ) );
+
+                if( next_ < end_ )
+                {
+                    *next_++ = b;
+                }
+                else
+                {
+                    overflow_ = true;
+                }
+            }
+        }
+
+        // count_ < 64, so bytes < 8
+
+        if( Order == order::big )
+        {
+            cache_ <<= bytes * 8;
+        }
+        else
+        {
+            cache_ >>= bytes * 8;
+        }
+
+        count_ &= 7;
+    }
+
+    // 1 <= n <= 56, v < 2^n
+
+    void put_bits( std::uint64_t v, unsigned n ) BOOST_NOEXCEPT
+    {
+        if( count_ + n > 63 ) flush_bytes();
+
+        if( Order == order::big )
+        {
+            cache_ |= v << ( 64 - count_ - n );
+        }
+        else
+        {
+            cache_ |= v << count_;
+        }
+
+        count_ += n;
+    }
+
+public:
+
+    bit_writer( unsigned char * p, std::size_t n ) BOOST_NOEXCEPT:
+        first_( p ), next_( p ), end_( p + n ), cache_( 0 ), count_( 0 ), overflow_( false )
+    {
+    }
+
+    //  Requires: n <= 64
+    //  Effects: appends the n least significant bits of v
+
+    void write( std::uint64_t v, unsigned n ) BOOST_NOEXCEPT
+    {
+        if( n == 0 ) return;
+
+        v &= detail::bit_mask( n );
+
+        if( n <= 56 )
+        {
+            put_bits( v, n );
+        }
+        else if( Order == order::big )
+        {
+            put_bits( v >> 32, n - 32 );
+            put_bits( v & 0xFFFFFFFFu, 32 );
+        }
+        else
+        {
+            put_bits( v & 0xFFFFFFFFu, 32 );
+            put_bits( v >> 32, n - 32 );
+        }
+    }
+
+    void write_bit( bool v ) BOOST_NOEXCEPT
+    {
+        put_bits( v, 1 );
+    }
+
+    //  Pads with zero bits to the next byte boundary
+
+    void align() BOOST_NOEXCEPT
+    {
+        unsigned const n = ( 8 - count_ % 8 ) % 8;
+        if( n != 0 ) put_bits( 0, n );
+    }
+
+    //  Effects: align(), then writes out all buffered bits
+    //  Returns: the number of bytes written so far
+
+    std::size_t flush() BOOST_NOEXCEPT
+    {
+        align();
+        flush_bytes();
+
+        return static_cast<std::size_t>( next_ - first_ );
+    }
+
+    //  Returns: the number of bits written so far
+
+    std::size_t position() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( next_ - first_ ) * 8 + count_;
+    }
+
+    bool overflow() const BOOST_NOEXCEPT
+    {
+        return overflow_;
+    }
+};
+
+//  bit_field  -------------------------------------------------------------------------//
+
+//  Accesses the field with a single load (and store) of the bytes it spans;
+//  all shifts and masks are compile-time constants.
+
+template<std::size_t Offset, std::size_t Width, order Order, class T>
+struct bit_field
+{
+    BOOST_ENDIAN_STATIC_ASSERT( Order == order::big || Order == order::little );
+    BOOST_ENDIAN_STATIC_ASSERT( Width >= 1 && Offset % 8 + Width <= 64 );
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value && Width <= sizeof(T) * 8 );
+
+    typedef T value_type;
+
+    static BOOST_CONSTEXPR_OR_CONST std::size_t offset = Offset;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t width = Width;
+
+    //  bytes spanned by the field, starting at byte Offset / 8
+    static BOOST_CONSTEXPR_OR_CONST std::size_t bytes = ( Offset % 8 + Width + 7 ) / 8;
+
+private:
+
+    static BOOST_CONSTEXPR_OR_CONST unsigned shift = Order == order::big?
+        static_cast<unsigned>( bytes * 8 - Offset % 8 - Width ): static_cast<unsigned>( Offset % 8 );
+
+    static std::uint64_t mask() BOOST_NOEXCEPT
+    {
+        return detail::bit_mask( Width );
+    }
+
+public:
+
+    static T get( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        std::uint64_t w = boost::endian::endian_load<std::uint64_t, bytes, Order>( p + Offset / 8 );
+        return detail::bit_extend<T>( ( w >> shift ) & mask(), Width, std::integral_constant<bool, std::is_signed<T>::value>() );
+    }
+
+    static void set( unsigned char * p, T v ) BOOST_NOEXCEPT
+    {
+        unsigned char * q = p + Offset / 8;
+
+        std::uint64_t w = boost::endian::endian_load<std::uint64_t, bytes, Order>( q );
+
+        w &= ~( mask() << shift );
+        w |= ( static_cast<std::uint64_t>( v ) & mask() ) << shift;
+
+        boost::endian::endian_store<std::uint64_t, bytes, Order>( q, w );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<std::size_t Offset, std::size_t Width, order Order, class T>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_field<Offset, Width, Order, T>::offset;
+
+template<std::size_t Offset, std::size_t Width, order Order, class T>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_field<Offset, Width, Order, T>::width;
+
+template<std::size_t Offset, std::size_t Width, order Order, class T>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_field<Offset, Width, Order, T>::bytes;
+
+#endif
+
+//  bit_layout  ------------------------------------------------------------------------//
+
+namespace detail
+{
+
+template<std::size_t I, std::size_t... W> struct bit_offset;
+
+template<std::size_t W1, std::size_t... W> struct bit_offset<0, W1, W...>
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t value = 0;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t width = W1;
+};
+
+template<std::size_t I, std::size_t W1, std::size_t... W> struct bit_offset<I, W1, W...>
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t value = W1 + bit_offset<I - 1, W...>::value;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t width = bit_offset<I - 1, W...>::width;
+};
+
+template<std::size_t... W> struct bit_sum;
+
+template<> struct bit_sum<>
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t value = 0;
+};
+
+template<std::size_t W1, std::size_t... W> struct bit_sum<W1, W...>
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t value = W1 + bit_sum<W...>::value;
+};
+
+} // namespace detail
+
+template<order Order, std::size_t... Widths>
+struct bit_layout
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t size = sizeof...(Widths);
+    static BOOST_CONSTEXPR_OR_CONST std::size_t size_bits = detail::bit_sum<Widths...>::value;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t size_bytes = ( size_bits + 7 ) / 8;
+
+    template<std::size_t I, class T = std::uint64_t> struct field:
+        bit_field<detail::bit_offset<I, Widths...>::value, detail::bit_offset<I, Widths...>::width, Order, T>
+    {
+    };
+
+    template<std::size_t I> static std::uint64_t get( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        return field<I>::get( p );
+    }
+
+    template<std::size_t I> static void set( unsigned char * p, std::uint64_t v ) BOOST_NOEXCEPT
+    {
+        field<I>::set( p, v );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<order Order, std::size_t... Widths>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_layout<Order, Widths...>::size;
+
+template<order Order, std::size_t... Widths>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_layout<Order, Widths...>::size_bits;
+
+template<order Order, std::size_t... Widths>
+BOOST_CONSTEXPR_OR_CONST std::size_t bit_layout<Order, Widths...>::size_bytes;
+
+#endif
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_BIT_STREAM_HPP_INCLUDED
@@ -29,6 +29,7 @@
 
 #include <boost/endian/detail/endian_store.hpp>
 #include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/is_constant_evaluated.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -221,20 +222,20 @@ public:
 
     endian_buffer() = default;
 
-    explicit endian_buffer( T val ) BOOST_NOEXCEPT
+    BOOST_ENDIAN_CXX20_CONSTEXPR explicit endian_buffer( T val ) BOOST_NOEXCEPT
     {
         boost::endian::endian_store<T, n_bits / 8, Order>( value_, val );
     }
 
 #endif
 
-    endian_buffer& operator=( T val ) BOOST_NOEXCEPT
+    BOOST_ENDIAN_CXX20_CONSTEXPR endian_buffer& operator=( T val ) BOOST_NOEXCEPT
     {
         boost::endian::endian_store<T, n_bits / 8, Order>( value_, val );
         return *this;
     }
 
-    value_type value() const BOOST_NOEXCEPT
+    BOOST_ENDIAN_CXX20_CONSTEXPR value_type value() const BOOST_NOEXCEPT
     {
         return boost::endian::endian_load<T, n_bits / 8, Order>( value_ );
     }
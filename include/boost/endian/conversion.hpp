@@ -11,6 +11,7 @@
 #include <boost/endian/detail/endian_reverse.hpp>
 #include <boost/endian/detail/endian_load.hpp>
 #include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/endian_bulk.hpp>
 #include <boost/endian/detail/order.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <boost/config.hpp>
@@ -140,6 +141,32 @@ namespace endian
     order from_order, order to_order)
     BOOST_NOEXCEPT;
 
+  //  bulk load, store and reverse in place
+  //  in detail/endian_bulk.hpp
+  //
+  //  template<class T, order Order>
+  //    void endian_load_n(unsigned char const * p, std::size_t n, T * out) BOOST_NOEXCEPT;
+  //  template<class T, order Order>
+  //    void endian_store_n(T const * first, std::size_t n, unsigned char * p) BOOST_NOEXCEPT;
+  //  template<class T>
+  //    void endian_reverse_inplace_n(T * first, std::size_t n) BOOST_NOEXCEPT;
+  //  template<order From, order To, class T>
+  //    void conditional_reverse_inplace_n(T * first, std::size_t n) BOOST_NOEXCEPT;
+  //  template<class T>
+  //    void conditional_reverse_inplace_n(T * first, std::size_t n,
+  //      order from_order, order to_order) BOOST_NOEXCEPT;
+  //
+  //  fused delta and frame of reference coding
+  //
+  //  template<class T, order Order>
+  //    void endian_load_delta_n(unsigned char const * p, std::size_t n, T base, T * out) BOOST_NOEXCEPT;
+  //  template<class T, order Order>
+  //    void endian_store_delta_n(T const * first, std::size_t n, T base, unsigned char * p) BOOST_NOEXCEPT;
+  //  template<class T, order Order>
+  //    void endian_load_offset_n(unsigned char const * p, std::size_t n, T base, T * out) BOOST_NOEXCEPT;
+  //  template<class T, order Order>
+  //    void endian_store_offset_n(T const * first, std::size_t n, T base, unsigned char * p) BOOST_NOEXCEPT;
+
 //----------------------------------- end synopsis -------------------------------------//
 
 template <class EndianReversible>
@@ -276,308 +303,308 @@ inline void conditional_reverse_inplace( EndianReversibleInplace& x,
 
 // load 16
 
-inline std::int16_t load_little_s16( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int16_t load_little_s16( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int16_t, 2, order::little>( p );
 }
 
-inline std::uint16_t load_little_u16( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint16_t load_little_u16( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint16_t, 2, order::little>( p );
 }
 
-inline std::int16_t load_big_s16( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int16_t load_big_s16( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int16_t, 2, order::big>( p );
 }
 
-inline std::uint16_t load_big_u16( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint16_t load_big_u16( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint16_t, 2, order::big>( p );
 }
 
 // load 24
 
-inline std::int32_t load_little_s24( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int32_t load_little_s24( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int32_t, 3, order::little>( p );
 }
 
-inline std::uint32_t load_little_u24( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint32_t load_little_u24( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint32_t, 3, order::little>( p );
 }
 
-inline std::int32_t load_big_s24( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int32_t load_big_s24( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int32_t, 3, order::big>( p );
 }
 
-inline std::uint32_t load_big_u24( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint32_t load_big_u24( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint32_t, 3, order::big>( p );
 }
 
 // load 32
 
-inline std::int32_t load_little_s32( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int32_t load_little_s32( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int32_t, 4, order::little>( p );
 }
 
-inline std::uint32_t load_little_u32( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint32_t load_little_u32( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint32_t, 4, order::little>( p );
 }
 
-inline std::int32_t load_big_s32( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int32_t load_big_s32( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int32_t, 4, order::big>( p );
 }
 
-inline std::uint32_t load_big_u32( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint32_t load_big_u32( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint32_t, 4, order::big>( p );
 }
 
 // load 40
 
-inline std::int64_t load_little_s40( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_little_s40( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 5, order::little>( p );
 }
 
-inline std::uint64_t load_little_u40( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_little_u40( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 5, order::little>( p );
 }
 
-inline std::int64_t load_big_s40( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_big_s40( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 5, order::big>( p );
 }
 
-inline std::uint64_t load_big_u40( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_big_u40( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 5, order::big>( p );
 }
 
 // load 48
 
-inline std::int64_t load_little_s48( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_little_s48( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 6, order::little>( p );
 }
 
-inline std::uint64_t load_little_u48( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_little_u48( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 6, order::little>( p );
 }
 
-inline std::int64_t load_big_s48( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_big_s48( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 6, order::big>( p );
 }
 
-inline std::uint64_t load_big_u48( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_big_u48( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 6, order::big>( p );
 }
 
 // load 56
 
-inline std::int64_t load_little_s56( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_little_s56( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 7, order::little>( p );
 }
 
-inline std::uint64_t load_little_u56( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_little_u56( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 7, order::little>( p );
 }
 
-inline std::int64_t load_big_s56( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_big_s56( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 7, order::big>( p );
 }
 
-inline std::uint64_t load_big_u56( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_big_u56( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 7, order::big>( p );
 }
 
 // load 64
 
-inline std::int64_t load_little_s64( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_little_s64( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 8, order::little>( p );
 }
 
-inline std::uint64_t load_little_u64( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_little_u64( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 8, order::little>( p );
 }
 
-inline std::int64_t load_big_s64( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::int64_t load_big_s64( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::int64_t, 8, order::big>( p );
 }
 
-inline std::uint64_t load_big_u64( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR std::uint64_t load_big_u64( unsigned char const * p ) BOOST_NOEXCEPT
 {
     return boost::endian::endian_load<std::uint64_t, 8, order::big>( p );
 }
 
 // store 16
 
-inline void store_little_s16( unsigned char * p, std::int16_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s16( unsigned char * p, std::int16_t v )
 {
     boost::endian::endian_store<std::int16_t, 2, order::little>( p, v );
 }
 
-inline void store_little_u16( unsigned char * p, std::uint16_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u16( unsigned char * p, std::uint16_t v )
 {
     boost::endian::endian_store<std::uint16_t, 2, order::little>( p, v );
 }
 
-inline void store_big_s16( unsigned char * p, std::int16_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s16( unsigned char * p, std::int16_t v )
 {
     boost::endian::endian_store<std::int16_t, 2, order::big>( p, v );
 }
 
-inline void store_big_u16( unsigned char * p, std::uint16_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u16( unsigned char * p, std::uint16_t v )
 {
     boost::endian::endian_store<std::uint16_t, 2, order::big>( p, v );
 }
 
 // store 24
 
-inline void store_little_s24( unsigned char * p, std::int32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s24( unsigned char * p, std::int32_t v )
 {
     boost::endian::endian_store<std::int32_t, 3, order::little>( p, v );
 }
 
-inline void store_little_u24( unsigned char * p, std::uint32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u24( unsigned char * p, std::uint32_t v )
 {
     boost::endian::endian_store<std::uint32_t, 3, order::little>( p, v );
 }
 
-inline void store_big_s24( unsigned char * p, std::int32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s24( unsigned char * p, std::int32_t v )
 {
     boost::endian::endian_store<std::int32_t, 3, order::big>( p, v );
 }
 
-inline void store_big_u24( unsigned char * p, std::uint32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u24( unsigned char * p, std::uint32_t v )
 {
     boost::endian::endian_store<std::uint32_t, 3, order::big>( p, v );
 }
 
 // store 32
 
-inline void store_little_s32( unsigned char * p, std::int32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s32( unsigned char * p, std::int32_t v )
 {
     boost::endian::endian_store<std::int32_t, 4, order::little>( p, v );
 }
 
-inline void store_little_u32( unsigned char * p, std::uint32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u32( unsigned char * p, std::uint32_t v )
 {
     boost::endian::endian_store<std::uint32_t, 4, order::little>( p, v );
 }
 
-inline void store_big_s32( unsigned char * p, std::int32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s32( unsigned char * p, std::int32_t v )
 {
     boost::endian::endian_store<std::int32_t, 4, order::big>( p, v );
 }
 
-inline void store_big_u32( unsigned char * p, std::uint32_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u32( unsigned char * p, std::uint32_t v )
 {
     boost::endian::endian_store<std::uint32_t, 4, order::big>( p, v );
 }
 
 // store 40
 
-inline void store_little_s40( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s40( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 5, order::little>( p, v );
 }
 
-inline void store_little_u40( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u40( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 5, order::little>( p, v );
 }
 
-inline void store_big_s40( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s40( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 5, order::big>( p, v );
 }
 
-inline void store_big_u40( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u40( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 5, order::big>( p, v );
 }
 
 // store 48
 
-inline void store_little_s48( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s48( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 6, order::little>( p, v );
 }
 
-inline void store_little_u48( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u48( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 6, order::little>( p, v );
 }
 
-inline void store_big_s48( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s48( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 6, order::big>( p, v );
 }
 
-inline void store_big_u48( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u48( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 6, order::big>( p, v );
 }
 
 // store 56
 
-inline void store_little_s56( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s56( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 7, order::little>( p, v );
 }
 
-inline void store_little_u56( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u56( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 7, order::little>( p, v );
 }
 
-inline void store_big_s56( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s56( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 7, order::big>( p, v );
 }
 
-inline void store_big_u56( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u56( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 7, order::big>( p, v );
 }
 
 // store 64
 
-inline void store_little_s64( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_s64( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 8, order::little>( p, v );
 }
 
-inline void store_little_u64( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_little_u64( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 8, order::little>( p, v );
 }
 
-inline void store_big_s64( unsigned char * p, std::int64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_s64( unsigned char * p, std::int64_t v )
 {
     boost::endian::endian_store<std::int64_t, 8, order::big>( p, v );
 }
 
-inline void store_big_u64( unsigned char * p, std::uint64_t v )
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void store_big_u64( unsigned char * p, std::uint64_t v )
 {
     boost::endian::endian_store<std::uint64_t, 8, order::big>( p, v );
 }
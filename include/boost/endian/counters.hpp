@@ -0,0 +1,201 @@
+#ifndef BOOST_ENDIAN_COUNTERS_HPP_INCLUDED
+#define BOOST_ENDIAN_COUNTERS_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  Counts of calls and bytes converted, kept per thread when the library
+  //  is compiled with BOOST_ENDIAN_ENABLE_COUNTERS defined, as announced by
+  //  conversion_counters_enabled. Otherwise, all counts are zero.
+
+  struct conversion_count;      //  calls, bytes
+  struct conversion_counters;   //  reverse[5], load[2][8], store[2][8], bulk[5]
+
+  //  Returns: the counts of all threads, including those that have exited
+  conversion_counters conversion_counters_snapshot();
+
+  //  Returns: the counts of the calling thread
+  conversion_counters this_thread_conversion_counters() BOOST_NOEXCEPT;
+
+  //  Returns: the counts made between the snapshots b and a
+  conversion_counters operator-( conversion_counters const & a, conversion_counters const & b ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+BOOST_CONSTEXPR_OR_CONST bool conversion_counters_enabled = true;
+
+#else
+
+BOOST_CONSTEXPR_OR_CONST bool conversion_counters_enabled = false;
+
+#endif
+
+struct conversion_count
+{
+    std::uint64_t calls;
+    std::uint64_t bytes;
+};
+
+struct conversion_counters
+{
+    // endian_reverse and endian_reverse_inplace, by width: 1, 2, 4, 8, 16 bytes
+    conversion_count reverse[ detail::conversion_width_classes ];
+
+    // endian_load and endian_store, by order (big, little) and by size minus one
+    conversion_count load[ 2 ][ detail::conversion_load_store_sizes ];
+    conversion_count store[ 2 ][ detail::conversion_load_store_sizes ];
+
+    // the bulk functions, by element size: 1, 2, 4, 8, 16 bytes
+    conversion_count bulk[ detail::conversion_width_classes ];
+
+    // Returns: the sum of all counts
+
+    conversion_count total() const BOOST_NOEXCEPT;
+};
+
+namespace detail
+{
+
+// the element of c for the counter index i
+
+inline conversion_count & conversion_count_at( conversion_counters & c, std::size_t i ) BOOST_NOEXCEPT
+{
+    if( i < conversion_load_first )
+    {
+        return c.reverse[ i - conversion_reverse_first ];
+    }
+    else if( i < conversion_store_first )
+    {
+        i -= conversion_load_first;
+        return c.load[ i / conversion_load_store_sizes ][ i % conversion_load_store_sizes ];
+    }
+    else if( i < conversion_bulk_first )
+    {
+        i -= conversion_store_first;
+        return c.store[ i / conversion_load_store_sizes ][ i % conversion_load_store_sizes ];
+    }
+    else
+    {
+        return c.bulk[ i - conversion_bulk_first ];
+    }
+}
+
+inline conversion_count const & conversion_count_at( conversion_counters const & c, std::size_t i ) BOOST_NOEXCEPT
+{
+    return conversion_count_at( const_cast<conversion_counters&>( c ), i );
+}
+
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+inline conversion_counters make_conversion_counters( conversion_counter_values const & v ) BOOST_NOEXCEPT
+{
+    conversion_counters r;
+
+    for( std::size_t i = 0; i < conversion_counter_count; ++i )
+    {
+        conversion_count & c = conversion_count_at( r, i );
+
+        c.calls = v.calls[ i ];
+        c.bytes = v.bytes[ i ];
+    }
+
+    return r;
+}
+
+#endif
+
+} // namespace detail
+
+inline conversion_count conversion_counters::total() const BOOST_NOEXCEPT
+{
+    conversion_count r = { 0, 0 };
+
+    for( std::size_t i = 0; i < detail::conversion_counter_count; ++i )
+    {
+        conversion_count const & c = detail::conversion_count_at( *this, i );
+
+        r.calls += c.calls;
+        r.bytes += c.bytes;
+    }
+
+    return r;
+}
+
+inline conversion_counters conversion_counters_snapshot()
+{
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+    detail::conversion_counter_values v = {};
+    detail::conversion_counter_registry::instance().add_to( v );
+
+    return detail::make_conversion_counters( v );
+
+#else
+
+    conversion_counters r = {};
+    return r;
+
+#endif
+}
+
+inline conversion_counters this_thread_conversion_counters() BOOST_NOEXCEPT
+{
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+    detail::conversion_counter_values v = {};
+    detail::this_thread_conversion_counter_block().add_to( v );
+
+    return detail::make_conversion_counters( v );
+
+#else
+
+    conversion_counters r = {};
+    return r;
+
+#endif
+}
+
+inline conversion_counters operator-( conversion_counters const & a, conversion_counters const & b ) BOOST_NOEXCEPT
+{
+    conversion_counters r;
+
+    for( std::size_t i = 0; i < detail::conversion_counter_count; ++i )
+    {
+        conversion_count & c = detail::conversion_count_at( r, i );
+
+        c.calls = detail::conversion_count_at( a, i ).calls - detail::conversion_count_at( b, i ).calls;
+        c.bytes = detail::conversion_count_at( a, i ).bytes - detail::conversion_count_at( b, i ).bytes;
+    }
+
+    return r;
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_COUNTERS_HPP_INCLUDED
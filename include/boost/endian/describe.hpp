@@ -0,0 +1,162 @@
+#ifndef BOOST_ENDIAN_DESCRIBE_HPP_INCLUDED
+#define BOOST_ENDIAN_DESCRIBE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Including this header makes endian_reverse_inplace, and therefore the
+// conditional and in place conversion functions, work on classes described
+// with BOOST_DESCRIBE_STRUCT or BOOST_DESCRIBE_CLASS. Requires Boost.Describe
+// and C++14.
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/endian_bulk.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/describe/bases.hpp>
+#include <boost/describe/members.hpp>
+#include <boost/describe/modifiers.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace detail
+{
+
+// A run of adjacent arithmetic members of the same size, reversed with one
+// call to the bulk kernel. The addresses are known after inlining, so the
+// comparisons in add() fold away and only the merged reversals remain.
+
+struct endian_reverse_described_run
+{
+    unsigned char * p;
+    std::size_t width;
+    std::size_t count;
+
+    void add( unsigned char * q, std::size_t w, std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( count != 0 && w == width && q == p + count * width )
+        {
+            count += n;
+        }
+        else
+        {
+            flush();
+
+            p = q;
+            width = w;
+            count = n;
+        }
+    }
+
+    void flush() BOOST_NOEXCEPT
+    {
+        if( count == 0 ) return;
+
+        BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( width ), count * width );
+
+        switch( width )
+        {
+        case 2:
+            detail::endian_reverse_n_impl<2>::call( p, p, count );
+            break;
+
+        case 4:
+            detail::endian_reverse_n_impl<4>::call( p, p, count );
+            break;
+
+        case 8:
+            detail::endian_reverse_n_impl<8>::call( p, p, count );
+            break;
+        }
+
+        count = 0;
+    }
+};
+
+// Arithmetic members, and arrays of them, join the run; single bytes need
+// no reversal. Other members are reversed with an unqualified call to
+// endian_reverse_inplace, which recurses into described members and uses
+// the user-provided functions for other class types and for enumerations.
+
+template<class M, class E = typename std::remove_all_extents<M>::type> struct endian_reverse_described_mergeable: std::integral_constant<bool,
+    detail::is_endian_reversible_inplace<E>::value && std::is_arithmetic<E>::value &&
+    ( sizeof(E) == 1 || sizeof(E) == 2 || sizeof(E) == 4 || sizeof(E) == 8 )>
+{
+};
+
+template<class M> inline void endian_reverse_described_member_impl( M & m, endian_reverse_described_run & r, std::true_type ) BOOST_NOEXCEPT
+{
+    typedef typename std::remove_all_extents<M>::type E;
+
+    if( sizeof(E) > 1 )
+    {
+        r.add( reinterpret_cast<unsigned char*>( &m ), sizeof(E), sizeof(M) / sizeof(E) );
+    }
+}
+
+template<class M> inline void endian_reverse_described_member_impl( M & m, endian_reverse_described_run & r, std::false_type ) BOOST_NOEXCEPT
+{
+    r.flush();
+    endian_reverse_inplace( m );
+}
+
+template<class T> struct endian_reverse_described_base
+{
+    T & x;
+
+    template<class D> void operator()( D ) const BOOST_NOEXCEPT
+    {
+        // the C-style cast converts to protected and private bases too
+
+        endian_reverse_inplace( (typename D::type &)x );
+    }
+};
+
+template<class T> struct endian_reverse_described_member
+{
+    T & x;
+    endian_reverse_described_run & r;
+
+    template<class D> void operator()( D ) const BOOST_NOEXCEPT
+    {
+        typedef typename std::remove_reference<decltype( x.*D::pointer )>::type M;
+
+        detail::endian_reverse_described_member_impl( x.*D::pointer, r, endian_reverse_described_mergeable<M>() );
+    }
+};
+
+// Reverses the bases, whatever their access, then the nonstatic data
+// members, merging adjacent arithmetic members of the same size into one
+// bulk reversal, so that for example four consecutive std::uint32_t members
+// are reversed as one array.
+
+template<class T> struct endian_reverse_inplace_udt<T, typename std::enable_if<
+    describe::has_describe_members<T>::value && !std::is_union<T>::value >::type>
+{
+    static void call( T & x ) BOOST_NOEXCEPT
+    {
+        typedef describe::describe_bases<T, describe::mod_any_access> Bd;
+        typedef describe::describe_members<T, describe::mod_any_access> Md;
+
+        mp11::mp_for_each<Bd>( endian_reverse_described_base<T>{ x } );
+
+        endian_reverse_described_run r = { 0, 0, 0 };
+
+        mp11::mp_for_each<Md>( endian_reverse_described_member<T>{ x, r } );
+
+        r.flush();
+    }
+};
+
+} // namespace detail
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DESCRIBE_HPP_INCLUDED
@@ -0,0 +1,220 @@
+#ifndef BOOST_ENDIAN_DETAIL_CONVERSION_COUNTERS_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_CONVERSION_COUNTERS_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Per-thread call and byte counters for the conversion functions, enabled
+// by defining BOOST_ENDIAN_ENABLE_COUNTERS. When it's not defined, the
+// counting macros expand to nothing.
+
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+# include <atomic>
+# include <mutex>
+# include <cstdint>
+#endif
+
+namespace boost
+{
+namespace endian
+{
+namespace detail
+{
+
+// Counter indices: endian_reverse and endian_reverse_inplace by width,
+// endian_load and endian_store by order and size, bulk kernels by element
+// size. Widths and element sizes of 1, 2, 4, 8 and 16 bytes map to 0..4.
+
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_width_classes = 5;
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_load_store_sizes = 8;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_reverse_first = 0;
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_load_first = conversion_reverse_first + conversion_width_classes;
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_store_first = conversion_load_first + 2 * conversion_load_store_sizes;
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_bulk_first = conversion_store_first + 2 * conversion_load_store_sizes;
+BOOST_CONSTEXPR_OR_CONST std::size_t conversion_counter_count = conversion_bulk_first + conversion_width_classes;
+
+inline BOOST_CONSTEXPR std::size_t conversion_width_class( std::size_t n ) BOOST_NOEXCEPT
+{
+    return n <= 1? 0: n <= 2? 1: n <= 4? 2: n <= 8? 3: 4;
+}
+
+inline BOOST_CONSTEXPR std::size_t conversion_reverse_index( std::size_t n ) BOOST_NOEXCEPT
+{
+    return conversion_reverse_first + conversion_width_class( n );
+}
+
+inline BOOST_CONSTEXPR std::size_t conversion_load_index( order o, std::size_t n ) BOOST_NOEXCEPT
+{
+    return conversion_load_first + ( o == order::big? 0: conversion_load_store_sizes ) + n - 1;
+}
+
+inline BOOST_CONSTEXPR std::size_t conversion_store_index( order o, std::size_t n ) BOOST_NOEXCEPT
+{
+    return conversion_store_first + ( o == order::big? 0: conversion_load_store_sizes ) + n - 1;
+}
+
+inline BOOST_CONSTEXPR std::size_t conversion_bulk_index( std::size_t n ) BOOST_NOEXCEPT
+{
+    return conversion_bulk_first + conversion_width_class( n );
+}
+
+#if defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+struct conversion_counter
+{
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> bytes;
+};
+
+struct conversion_counter_values
+{
+    std::uint64_t calls[ conversion_counter_count ];
+    std::uint64_t bytes[ conversion_counter_count ];
+};
+
+// Each thread owns a block, so the increments don't need atomic
+// read-modify-write operations; the counters are atomic only so that
+// snapshots can read them from other threads.
+
+struct conversion_counter_block
+{
+    conversion_counter counters[ conversion_counter_count ];
+    conversion_counter_block * next;
+
+    conversion_counter_block() BOOST_NOEXCEPT: next( 0 )
+    {
+        for( std::size_t i = 0; i < conversion_counter_count; ++i )
+        {
+            counters[ i ].calls.store( 0, std::memory_order_relaxed );
+            counters[ i ].bytes.store( 0, std::memory_order_relaxed );
+        }
+    }
+
+    void add_to( conversion_counter_values & v ) const BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < conversion_counter_count; ++i )
+        {
+            v.calls[ i ] += counters[ i ].calls.load( std::memory_order_relaxed );
+            v.bytes[ i ] += counters[ i ].bytes.load( std::memory_order_relaxed );
+        }
+    }
+};
+
+// The blocks of the live threads, and the totals of the exited ones
+
+struct conversion_counter_registry
+{
+    std::mutex mx;
+    conversion_counter_block * head;
+    conversion_counter_values retired;
+
+    conversion_counter_registry() BOOST_NOEXCEPT: head( 0 ), retired()
+    {
+    }
+
+    static conversion_counter_registry & instance() BOOST_NOEXCEPT
+    {
+        static conversion_counter_registry r;
+        return r;
+    }
+
+    void add_to( conversion_counter_values & v )
+    {
+        std::lock_guard<std::mutex> lock( mx );
+
+        for( std::size_t i = 0; i < conversion_counter_count; ++i )
+        {
+            v.calls[ i ] += retired.calls[ i ];
+            v.bytes[ i ] += retired.bytes[ i ];
+        }
+
+        for( conversion_counter_block const * p = head; p; p = p->next )
+        {
+            p->add_to( v );
+        }
+    }
+};
+
+struct conversion_counter_thread_block: conversion_counter_block
+{
+    conversion_counter_registry & registry;
+
+    conversion_counter_thread_block(): registry( conversion_counter_registry::instance() )
+    {
+        std::lock_guard<std::mutex> lock( registry.mx );
+
+        next = registry.head;
+        registry.head = this;
+    }
+
+    ~conversion_counter_thread_block()
+    {
+        std::lock_guard<std::mutex> lock( registry.mx );
+
+        add_to( registry.retired );
+
+        conversion_counter_block ** pp = &registry.head;
+        while( *pp != this ) pp = &(*pp)->next;
+
+        *pp = next;
+    }
+};
+
+inline conversion_counter_block & this_thread_conversion_counter_block() BOOST_NOEXCEPT
+{
+    static thread_local conversion_counter_thread_block b;
+    return b;
+}
+
+inline void count_conversion( std::size_t index, std::size_t bytes ) BOOST_NOEXCEPT
+{
+    conversion_counter & c = this_thread_conversion_counter_block().counters[ index ];
+
+    c.calls.store( c.calls.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+    c.bytes.store( c.bytes.load( std::memory_order_relaxed ) + bytes, std::memory_order_relaxed );
+}
+
+# define BOOST_ENDIAN_COUNT_CONVERSION(index, bytes) ::boost::endian::detail::count_conversion( index, bytes )
+
+// endian_reverse is constexpr, so it can only count calls that are not
+// constant evaluated, which requires std::is_constant_evaluated or the
+// corresponding builtin
+
+# if defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+#  define BOOST_ENDIAN_COUNT_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+# elif defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#   define BOOST_ENDIAN_COUNT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+# endif
+
+# if defined(BOOST_ENDIAN_COUNT_IS_CONSTANT_EVALUATED)
+
+#  define BOOST_ENDIAN_COUNT_CONSTEXPR_REVERSE
+
+template<class T> inline BOOST_CONSTEXPR T count_constexpr_reverse( T x ) BOOST_NOEXCEPT
+{
+    return BOOST_ENDIAN_COUNT_IS_CONSTANT_EVALUATED()? x: ( count_conversion( conversion_reverse_index( sizeof(T) ), sizeof(T) ), x );
+}
+
+# endif
+
+#else
+
+# define BOOST_ENDIAN_COUNT_CONVERSION(index, bytes) ((void)0)
+
+#endif
+
+} // namespace detail
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DETAIL_CONVERSION_COUNTERS_HPP_INCLUDED
@@ -0,0 +1,352 @@
+#ifndef BOOST_ENDIAN_DETAIL_ENDIAN_BULK_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_ENDIAN_BULK_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_reverse.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/endian/detail/usdt.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/integral_by_size.hpp>
+#include <boost/endian/detail/is_trivially_copyable.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// Bulk kernels on arrays of N-byte elements. The loops are written so that
+// compilers can vectorize them (the byte reversal becomes a byte shuffle).
+// dst == src is allowed; otherwise the ranges must not overlap.
+
+template<std::size_t N> struct endian_reverse_n_scalar
+{
+    static void call( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        typedef typename integral_by_size<N>::type uintN_t;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            uintN_t tmp;
+            std::memcpy( &tmp, src + i * N, N );
+
+            tmp = endian_reverse_impl( tmp );
+
+            std::memcpy( dst + i * N, &tmp, N );
+        }
+    }
+};
+
+template<std::size_t N> struct endian_reverse_n_impl: endian_reverse_n_scalar<N>
+{
+};
+
+#if defined(BOOST_ENDIAN_NO_INTRINSICS)
+
+// Without byte swap intrinsics, 2 byte elements are reversed four at a
+// time, in 64-bit words ("SIMD within a register"). The lanes are aligned
+// to the element size, so the result doesn't depend on the native order.
+//
+// Wider elements gain nothing from this: compilers recognize the portable
+// 4 and 8 byte sequences in endian_reverse_impl as byte swaps.
+
+template<> struct endian_reverse_n_impl<2>
+{
+    static void call( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::size_t i = 0;
+
+        for( ; i + 4 <= n; i += 4 )
+        {
+            std::uint64_t w;
+            std::memcpy( &w, src + i * 2, 8 );
+
+            w = ( w & 0x00FF00FF00FF00FFULL ) << 8 | ( w >> 8 & 0x00FF00FF00FF00FFULL );
+
+            std::memcpy( dst + i * 2, &w, 8 );
+        }
+
+        endian_reverse_n_scalar<2>::call( dst + i * 2, src + i * 2, n - i );
+    }
+};
+
+#endif
+
+inline void endian_copy_bytes( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( n != 0 && dst != src )
+    {
+        std::memcpy( dst, src, n );
+    }
+}
+
+template<> struct endian_reverse_n_impl<1>
+{
+    static void call( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        endian_copy_bytes( dst, src, n );
+    }
+};
+
+template<std::size_t N> inline void endian_convert_n( unsigned char * dst, unsigned char const * src, std::size_t n, std::true_type ) BOOST_NOEXCEPT
+{
+    endian_copy_bytes( dst, src, n * N );
+}
+
+template<std::size_t N> inline void endian_convert_n( unsigned char * dst, unsigned char const * src, std::size_t n, std::false_type ) BOOST_NOEXCEPT
+{
+    endian_reverse_n_impl<N>::call( dst, src, n );
+}
+
+// converts n elements of N bytes from byte order From to byte order To
+
+template<std::size_t N, order From, order To> inline void endian_convert_n( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( N ), n * N );
+
+    detail::endian_convert_n<N>( dst, src, n, std::integral_constant<bool, From == To>() );
+}
+
+// single elements of the fused delta and offset kernels, as unsigned
+// integers so that the arithmetic wraps around
+
+template<class U> inline U endian_bulk_reverse( U x, std::true_type ) BOOST_NOEXCEPT
+{
+    return x;
+}
+
+template<class U> inline U endian_bulk_reverse( U x, std::false_type ) BOOST_NOEXCEPT
+{
+    return endian_reverse_impl( x );
+}
+
+template<class U, order Order> inline U endian_bulk_load( unsigned char const * p ) BOOST_NOEXCEPT
+{
+    U x;
+    std::memcpy( &x, p, sizeof(U) );
+
+    return detail::endian_bulk_reverse( x, std::integral_constant<bool, Order == order::native>() );
+}
+
+template<class U, order Order> inline void endian_bulk_store( unsigned char * p, U x ) BOOST_NOEXCEPT
+{
+    x = detail::endian_bulk_reverse( x, std::integral_constant<bool, Order == order::native>() );
+    std::memcpy( p, &x, sizeof(U) );
+}
+
+} // namespace detail
+
+// Requires:
+//
+//    sizeof(T) must be 1, 2, 4, or 8
+//    T is TriviallyCopyable
+//    [p, p + n * sizeof(T)) and [out, out + n) do not overlap
+//
+// Effects: out[i] = endian_load<T, sizeof(T), Order>( p + i * sizeof(T) ), i < n
+
+template<class T, order Order>
+inline void endian_load_n( unsigned char const * p, std::size_t n, T * out ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<T>::value );
+
+    BOOST_ENDIAN_USDT_BATCH( usdt_load_n, sizeof(T), n );
+
+    detail::endian_convert_n<sizeof(T), Order, order::native>( reinterpret_cast<unsigned char*>( out ), p, n );
+}
+
+// Requires:
+//
+//    sizeof(T) must be 1, 2, 4, or 8
+//    T is TriviallyCopyable
+//    [first, first + n) and [p, p + n * sizeof(T)) do not overlap
+//
+// Effects: endian_store<T, sizeof(T), Order>( p + i * sizeof(T), first[i] ), i < n
+
+template<class T, order Order>
+inline void endian_store_n( T const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<T>::value );
+
+    BOOST_ENDIAN_USDT_BATCH( usdt_store_n, sizeof(T), n );
+
+    detail::endian_convert_n<sizeof(T), order::native, Order>( p, reinterpret_cast<unsigned char const*>( first ), n );
+}
+
+// Requires: T is integral, enumeration, float or double
+//
+// Effects: endian_reverse_inplace( first[i] ), i < n
+
+template<class T>
+inline void endian_reverse_inplace_n( T * first, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_reversible_inplace<T>::value );
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( sizeof(T) ), n * sizeof(T) );
+    BOOST_ENDIAN_USDT_BATCH( usdt_reverse_inplace_n, sizeof(T), n );
+
+    unsigned char * p = reinterpret_cast<unsigned char*>( first );
+    detail::endian_reverse_n_impl<sizeof(T)>::call( p, p, n );
+}
+
+namespace detail
+{
+
+template<class T> inline void conditional_reverse_inplace_n_impl( T *, std::size_t, std::true_type ) BOOST_NOEXCEPT
+{
+}
+
+template<class T> inline void conditional_reverse_inplace_n_impl( T * first, std::size_t n, std::false_type ) BOOST_NOEXCEPT
+{
+    boost::endian::endian_reverse_inplace_n( first, n );
+}
+
+} // namespace detail
+
+// Requires: T is integral, enumeration, float or double
+//
+// Effects: none if From == To, otherwise endian_reverse_inplace_n( first, n )
+
+template<order From, order To, class T>
+inline void conditional_reverse_inplace_n( T * first, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_reversible_inplace<T>::value );
+
+    detail::conditional_reverse_inplace_n_impl( first, n, std::integral_constant<bool, From == To>() );
+}
+
+// Requires: T is integral, enumeration, float or double
+//
+// Effects: none if from_order == to_order, otherwise endian_reverse_inplace_n( first, n )
+
+template<class T>
+inline void conditional_reverse_inplace_n( T * first, std::size_t n, order from_order, order to_order ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_reversible_inplace<T>::value );
+
+    if( from_order != to_order )
+    {
+        boost::endian::endian_reverse_inplace_n( first, n );
+    }
+}
+
+// Delta and frame of reference coding. The arithmetic is modulo 2^(8*sizeof(T)).
+
+// Requires:
+//
+//    T is integral, sizeof(T) must be 1, 2, 4, or 8
+//    [p, p + n * sizeof(T)) and [out, out + n) do not overlap
+//
+// Effects: out[i] = out[i-1] + endian_load<T, sizeof(T), Order>( p + i * sizeof(T) ),
+//          i < n, where out[-1] is base
+
+template<class T, order Order>
+inline void endian_load_delta_n( unsigned char const * p, std::size_t n, T base, T * out ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename detail::integral_by_size<sizeof(T)>::type U;
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( sizeof(T) ), n * sizeof(T) );
+    BOOST_ENDIAN_USDT_BATCH( usdt_load_delta_n, sizeof(T), n );
+
+    U acc = static_cast<U>( base );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        acc = static_cast<U>( acc + detail::endian_bulk_load<U, Order>( p + i * sizeof(T) ) );
+        out[ i ] = static_cast<T>( acc );
+    }
+}
+
+// Requires:
+//
+//    T is integral, sizeof(T) must be 1, 2, 4, or 8
+//    [first, first + n) and [p, p + n * sizeof(T)) do not overlap
+//
+// Effects: endian_store<T, sizeof(T), Order>( p + i * sizeof(T), first[i] - first[i-1] ),
+//          i < n, where first[-1] is base
+
+template<class T, order Order>
+inline void endian_store_delta_n( T const * first, std::size_t n, T base, unsigned char * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename detail::integral_by_size<sizeof(T)>::type U;
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( sizeof(T) ), n * sizeof(T) );
+    BOOST_ENDIAN_USDT_BATCH( usdt_store_delta_n, sizeof(T), n );
+
+    if( n == 0 ) return;
+
+    detail::endian_bulk_store<U, Order>( p, static_cast<U>( static_cast<U>( first[ 0 ] ) - static_cast<U>( base ) ) );
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        detail::endian_bulk_store<U, Order>( p + i * sizeof(T), static_cast<U>( static_cast<U>( first[ i ] ) - static_cast<U>( first[ i - 1 ] ) ) );
+    }
+}
+
+// Requires:
+//
+//    T is integral, sizeof(T) must be 1, 2, 4, or 8
+//    [p, p + n * sizeof(T)) and [out, out + n) do not overlap
+//
+// Effects: out[i] = base + endian_load<T, sizeof(T), Order>( p + i * sizeof(T) ), i < n
+
+template<class T, order Order>
+inline void endian_load_offset_n( unsigned char const * p, std::size_t n, T base, T * out ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename detail::integral_by_size<sizeof(T)>::type U;
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( sizeof(T) ), n * sizeof(T) );
+    BOOST_ENDIAN_USDT_BATCH( usdt_load_offset_n, sizeof(T), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        out[ i ] = static_cast<T>( static_cast<U>( static_cast<U>( base ) + detail::endian_bulk_load<U, Order>( p + i * sizeof(T) ) ) );
+    }
+}
+
+// Requires:
+//
+//    T is integral, sizeof(T) must be 1, 2, 4, or 8
+//    [first, first + n) and [p, p + n * sizeof(T)) do not overlap
+//
+// Effects: endian_store<T, sizeof(T), Order>( p + i * sizeof(T), first[i] - base ), i < n
+
+template<class T, order Order>
+inline void endian_store_offset_n( T const * first, std::size_t n, T base, unsigned char * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename detail::integral_by_size<sizeof(T)>::type U;
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( sizeof(T) ), n * sizeof(T) );
+    BOOST_ENDIAN_USDT_BATCH( usdt_store_offset_n, sizeof(T), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        detail::endian_bulk_store<U, Order>( p + i * sizeof(T), static_cast<U>( static_cast<U>( first[ i ] ) - static_cast<U>( base ) ) );
+    }
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DETAIL_ENDIAN_BULK_HPP_INCLUDED
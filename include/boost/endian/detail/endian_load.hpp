@@ -10,6 +10,8 @@
 #include <boost/endian/detail/order.hpp>
 #include <boost/endian/detail/integral_by_size.hpp>
 #include <boost/endian/detail/is_trivially_copyable.hpp>
+#include <boost/endian/detail/is_constant_evaluated.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <type_traits>
 #include <cstddef>
@@ -27,6 +29,36 @@ template<class T, std::size_t N1, order O1, std::size_t N2, order O2> struct end
 {
 };
 
+#if defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+// constant evaluation path; assembles the value byte by byte
+
+template<class T, std::size_t N, order Order>
+constexpr T endian_load_cx( unsigned char const * p ) noexcept
+{
+    typedef typename integral_by_size< sizeof(T) >::type uintN_t;
+
+    uintN_t v = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        uintN_t b = p[ Order == order::little? i: N - 1 - i ];
+        v |= static_cast<uintN_t>( b << ( 8 * i ) );
+    }
+
+    if constexpr( N < sizeof(T) && std::is_signed<T>::value )
+    {
+        if( p[ Order == order::little? N - 1: 0 ] & 0x80 )
+        {
+            v |= static_cast<uintN_t>( ~static_cast<uintN_t>( 0 ) << ( 8 * N ) );
+        }
+    }
+
+    return std::bit_cast<T>( v );
+}
+
+#endif
+
 } // namespace detail
 
 // Requires:
@@ -37,11 +69,22 @@ template<class T, std::size_t N1, order O1, std::size_t N2, order O2> struct end
 //    if N < sizeof(T), T is integral or enum
 
 template<class T, std::size_t N, order Order>
-inline T endian_load( unsigned char const * p ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR T endian_load( unsigned char const * p ) BOOST_NOEXCEPT
 {
     BOOST_ENDIAN_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
     BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= sizeof(T) );
 
+#if defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+    if( std::is_constant_evaluated() )
+    {
+        return detail::endian_load_cx<T, N, Order>( p );
+    }
+
+#endif
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_load_index( Order, N ), N );
+
     return detail::endian_load_impl<T, sizeof(T), order::native, N, Order>()( p );
 }
 
@@ -73,7 +116,7 @@ template<class T, std::size_t N, order O1, order O2> struct endian_load_impl<T,
         typename integral_by_size<N>::type tmp;
         std::memcpy( &tmp, p, N );
 
-        endian_reverse_inplace( tmp );
+        tmp = endian_reverse_impl( tmp );
 
         T t;
         std::memcpy( &t, &tmp, N );
@@ -94,7 +137,7 @@ template<class T, order Order> struct endian_load_impl<T, 2, Order, 1, order::li
         tmp[0] = p[0];
         tmp[1] = std::is_signed<T>::value && ( p[0] & 0x80 )? 0xFF: 0x00;
 
-        return boost::endian::endian_load<T, 2, order::little>( tmp );
+        return endian_load_impl<T, 2, order::native, 2, order::little>()( tmp );
     }
 };
 
@@ -109,7 +152,7 @@ template<class T, order Order> struct endian_load_impl<T, 2, Order, 1, order::bi
         tmp[0] = std::is_signed<T>::value && ( p[0] & 0x80 )? 0xFF: 0x00;
         tmp[1] = p[0];
 
-        return boost::endian::endian_load<T, 2, order::big>( tmp );
+        return endian_load_impl<T, 2, order::native, 2, order::big>()( tmp );
     }
 };
 
@@ -130,7 +173,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 1, order::li
         tmp[2] = fill;
         tmp[3] = fill;
 
-        return boost::endian::endian_load<T, 4, order::little>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::little>()( tmp );
     }
 };
 
@@ -149,7 +192,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 1, order::bi
         tmp[2] = fill;
         tmp[3] = p[0];
 
-        return boost::endian::endian_load<T, 4, order::big>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::big>()( tmp );
     }
 };
 
@@ -170,7 +213,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 2, order::li
         tmp[2] = fill;
         tmp[3] = fill;
 
-        return boost::endian::endian_load<T, 4, order::little>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::little>()( tmp );
     }
 };
 
@@ -189,7 +232,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 2, order::bi
         tmp[2] = p[0];
         tmp[3] = p[1];
 
-        return boost::endian::endian_load<T, 4, order::big>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::big>()( tmp );
     }
 };
 
@@ -208,7 +251,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 3, order::li
         tmp[2] = p[2];
         tmp[3] = std::is_signed<T>::value && ( p[2] & 0x80 )? 0xFF: 0x00;
 
-        return boost::endian::endian_load<T, 4, order::little>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::little>()( tmp );
     }
 };
 
@@ -225,7 +268,7 @@ template<class T, order Order> struct endian_load_impl<T, 4, Order, 3, order::bi
         tmp[2] = p[1];
         tmp[3] = p[2];
 
-        return boost::endian::endian_load<T, 4, order::big>( tmp );
+        return endian_load_impl<T, 4, order::native, 4, order::big>()( tmp );
     }
 };
 
@@ -251,7 +294,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 1, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -275,7 +318,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 1, order::bi
 
         tmp[7] = p[0];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -301,7 +344,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 2, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -325,7 +368,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 2, order::bi
         tmp[6] = p[0];
         tmp[7] = p[1];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -351,7 +394,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 3, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -375,7 +418,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 3, order::bi
         tmp[6] = p[1];
         tmp[7] = p[2];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -401,7 +444,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 4, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -425,7 +468,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 4, order::bi
         tmp[6] = p[2];
         tmp[7] = p[3];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -451,7 +494,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 5, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -475,7 +518,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 5, order::bi
         tmp[6] = p[3];
         tmp[7] = p[4];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -501,7 +544,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 6, order::li
         tmp[6] = fill;
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -525,7 +568,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 6, order::bi
         tmp[6] = p[4];
         tmp[7] = p[5];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
@@ -551,7 +594,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 7, order::li
 
         tmp[7] = fill;
 
-        return boost::endian::endian_load<T, 8, order::little>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::little>()( tmp );
     }
 };
 
@@ -575,7 +618,7 @@ template<class T, order Order> struct endian_load_impl<T, 8, Order, 7, order::bi
         tmp[6] = p[5];
         tmp[7] = p[6];
 
-        return boost::endian::endian_load<T, 8, order::big>( tmp );
+        return endian_load_impl<T, 8, order::native, 8, order::big>()( tmp );
     }
 };
 
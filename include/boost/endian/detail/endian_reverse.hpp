@@ -9,6 +9,8 @@
 #include <boost/endian/detail/intrinsic.hpp>
 #include <boost/endian/detail/is_scoped_enum.hpp>
 #include <boost/endian/detail/is_integral.hpp>
+#include <boost/endian/detail/is_constant_evaluated.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <boost/config.hpp>
 #include <type_traits>
@@ -25,6 +27,10 @@
 #else
 # if defined(BOOST_ENDIAN_CONSTEXPR_INTRINSICS)
 #  define BOOST_ENDIAN_CONSTEXPR BOOST_CONSTEXPR
+# elif defined(BOOST_ENDIAN_HAS_IS_CONSTANT_EVALUATED)
+// the intrinsics are used at run time, the portable code in constant expressions
+#  define BOOST_ENDIAN_CONSTEXPR constexpr
+#  define BOOST_ENDIAN_CONSTEXPR_FALLBACK
 # else
 #  define BOOST_ENDIAN_CONSTEXPR
 # endif
@@ -49,14 +55,41 @@ inline std::uint8_t BOOST_CONSTEXPR endian_reverse_impl( std::uint8_t x ) BOOST_
     return x;
 }
 
+inline std::uint16_t BOOST_CXX14_CONSTEXPR endian_reverse_portable( std::uint16_t x ) BOOST_NOEXCEPT
+{
+    return (x << 8) | (x >> 8);
+}
+
+inline std::uint32_t BOOST_CXX14_CONSTEXPR endian_reverse_portable( std::uint32_t x ) BOOST_NOEXCEPT
+{
+    std::uint32_t step16 = x << 16 | x >> 16;
+    return ((step16 << 8) & 0xff00ff00) | ((step16 >> 8) & 0x00ff00ff);
+}
+
+inline std::uint64_t BOOST_CXX14_CONSTEXPR endian_reverse_portable( std::uint64_t x ) BOOST_NOEXCEPT
+{
+    std::uint64_t step32 = x << 32 | x >> 32;
+    std::uint64_t step16 = (step32 & 0x0000FFFF0000FFFFULL) << 16 | (step32 & 0xFFFF0000FFFF0000ULL) >> 16;
+    return (step16 & 0x00FF00FF00FF00FFULL) << 8 | (step16 & 0xFF00FF00FF00FF00ULL) >> 8;
+}
+
 inline std::uint16_t BOOST_ENDIAN_CONSTEXPR endian_reverse_impl( std::uint16_t x ) BOOST_NOEXCEPT
 {
 #ifdef BOOST_ENDIAN_NO_INTRINSICS
 
-    return (x << 8) | (x >> 8);
+    return endian_reverse_portable( x );
 
 #else
 
+# ifdef BOOST_ENDIAN_CONSTEXPR_FALLBACK
+
+    if( std::is_constant_evaluated() )
+    {
+        return endian_reverse_portable( x );
+    }
+
+# endif
+
     return BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_2(x);
 
 #endif
@@ -66,11 +99,19 @@ inline std::uint32_t BOOST_ENDIAN_CONSTEXPR endian_reverse_impl( std::uint32_t x
 {
 #ifdef BOOST_ENDIAN_NO_INTRINSICS
 
-    std::uint32_t step16 = x << 16 | x >> 16;
-    return ((step16 << 8) & 0xff00ff00) | ((step16 >> 8) & 0x00ff00ff);
+    return endian_reverse_portable( x );
 
 #else
 
+# ifdef BOOST_ENDIAN_CONSTEXPR_FALLBACK
+
+    if( std::is_constant_evaluated() )
+    {
+        return endian_reverse_portable( x );
+    }
+
+# endif
+
     return BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_4(x);
 
 #endif
@@ -80,15 +121,22 @@ inline std::uint64_t BOOST_ENDIAN_CONSTEXPR endian_reverse_impl( std::uint64_t x
 {
 #ifdef BOOST_ENDIAN_NO_INTRINSICS
 
-    std::uint64_t step32 = x << 32 | x >> 32;
-    std::uint64_t step16 = (step32 & 0x0000FFFF0000FFFFULL) << 16 | (step32 & 0xFFFF0000FFFF0000ULL) >> 16;
-    return (step16 & 0x00FF00FF00FF00FFULL) << 8 | (step16 & 0xFF00FF00FF00FF00ULL) >> 8;
+    return endian_reverse_portable( x );
 
 #else
 
-    return BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_8(x);
+# ifdef BOOST_ENDIAN_CONSTEXPR_FALLBACK
+
+    if( std::is_constant_evaluated() )
+    {
+        return endian_reverse_portable( x );
+    }
 
 # endif
+
+    return BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_8(x);
+
+#endif
 }
 
 #if defined(__SIZEOF_INT128__)
@@ -128,7 +176,15 @@ template<class T> inline BOOST_CONSTEXPR
 
     typedef typename detail::integral_by_size< sizeof(T) >::type uintN_t;
 
+#if defined(BOOST_ENDIAN_COUNT_CONSTEXPR_REVERSE)
+
+    return static_cast<T>( detail::endian_reverse_impl( detail::count_constexpr_reverse( static_cast<uintN_t>( x ) ) ) );
+
+#else
+
     return static_cast<T>( detail::endian_reverse_impl( static_cast<uintN_t>( x ) ) );
+
+#endif
 }
 
 // Requires:
@@ -140,6 +196,8 @@ template<class T> inline
 {
     BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_reversible_inplace<T>::value );
 
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_reverse_index( sizeof(T) ), sizeof(T) );
+
     typename detail::integral_by_size< sizeof(T) >::type x2;
 
     std::memcpy( &x2, &x, sizeof(T) );
@@ -149,13 +207,28 @@ template<class T> inline
     std::memcpy( &x, &x2, sizeof(T) );
 }
 
+namespace detail
+{
+
+// Specialized in boost/endian/describe.hpp for described classes
+
+template<class T, class E = void> struct endian_reverse_inplace_udt
+{
+    static void call( T & x ) BOOST_NOEXCEPT
+    {
+        x = endian_reverse( x );
+    }
+};
+
+} // namespace detail
+
 // Default implementation for user-defined types
 
 template<class T> inline
     typename std::enable_if< std::is_class<T>::value >::type
     endian_reverse_inplace( T & x ) BOOST_NOEXCEPT
 {
-    x = endian_reverse( x );
+    detail::endian_reverse_inplace_udt<T>::call( x );
 }
 
 // endian_reverse_inplace for arrays
@@ -10,6 +10,8 @@
 #include <boost/endian/detail/order.hpp>
 #include <boost/endian/detail/integral_by_size.hpp>
 #include <boost/endian/detail/is_trivially_copyable.hpp>
+#include <boost/endian/detail/is_constant_evaluated.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
 #include <boost/endian/detail/static_assert.hpp>
 #include <type_traits>
 #include <cstddef>
@@ -27,6 +29,25 @@ template<class T, std::size_t N1, order O1, std::size_t N2, order O2> struct end
 {
 };
 
+#if defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+// constant evaluation path; writes the value byte by byte
+
+template<class T, std::size_t N, order Order>
+constexpr void endian_store_cx( unsigned char * p, T const & v ) noexcept
+{
+    typedef typename integral_by_size< sizeof(T) >::type uintN_t;
+
+    uintN_t w = std::bit_cast<uintN_t>( v );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        p[ Order == order::little? i: N - 1 - i ] = static_cast<unsigned char>( w >> ( 8 * i ) );
+    }
+}
+
+#endif
+
 } // namespace detail
 
 // Requires:
@@ -37,11 +58,23 @@ template<class T, std::size_t N1, order O1, std::size_t N2, order O2> struct end
 //    if N < sizeof(T), T is integral or enum
 
 template<class T, std::size_t N, order Order>
-inline void endian_store( unsigned char * p, T const & v ) BOOST_NOEXCEPT
+inline BOOST_ENDIAN_CXX20_CONSTEXPR void endian_store( unsigned char * p, T const & v ) BOOST_NOEXCEPT
 {
     BOOST_ENDIAN_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
     BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= sizeof(T) );
 
+#if defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+    if( std::is_constant_evaluated() )
+    {
+        detail::endian_store_cx<T, N, Order>( p, v );
+        return;
+    }
+
+#endif
+
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_store_index( Order, N ), N );
+
     return detail::endian_store_impl<T, sizeof(T), order::native, N, Order>()( p, v );
 }
 
@@ -71,7 +104,7 @@ template<class T, std::size_t N, order O1, order O2> struct endian_store_impl<T,
         typename integral_by_size<N>::type tmp;
         std::memcpy( &tmp, &v, N );
 
-        endian_reverse_inplace( tmp );
+        tmp = endian_reverse_impl( tmp );
 
         std::memcpy( p, &tmp, N );
     }
@@ -86,7 +119,7 @@ template<class T, order Order> struct endian_store_impl<T, 2, Order, 1, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 2 ];
-        boost::endian::endian_store<T, 2, order::little>( tmp, v );
+        endian_store_impl<T, 2, order::native, 2, order::little>()( tmp, v );
 
         p[0] = tmp[0];
     }
@@ -99,7 +132,7 @@ template<class T, order Order> struct endian_store_impl<T, 2, Order, 1, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 2 ];
-        boost::endian::endian_store<T, 2, order::big>( tmp, v );
+        endian_store_impl<T, 2, order::native, 2, order::big>()( tmp, v );
 
         p[0] = tmp[1];
     }
@@ -114,7 +147,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 1, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::little>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::little>()( tmp, v );
 
         p[0] = tmp[0];
     }
@@ -127,7 +160,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 1, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::big>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::big>()( tmp, v );
 
         p[0] = tmp[3];
     }
@@ -142,7 +175,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 2, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::little>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -156,7 +189,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 2, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::big>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::big>()( tmp, v );
 
         p[0] = tmp[2];
         p[1] = tmp[3];
@@ -172,7 +205,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 3, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::little>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -187,7 +220,7 @@ template<class T, order Order> struct endian_store_impl<T, 4, Order, 3, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 4 ];
-        boost::endian::endian_store<T, 4, order::big>( tmp, v );
+        endian_store_impl<T, 4, order::native, 4, order::big>()( tmp, v );
 
         p[0] = tmp[1];
         p[1] = tmp[2];
@@ -204,7 +237,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 1, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
     }
@@ -217,7 +250,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 1, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[7];
     }
@@ -232,7 +265,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 2, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -246,7 +279,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 2, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[6];
         p[1] = tmp[7];
@@ -262,7 +295,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 3, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -277,7 +310,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 3, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[5];
         p[1] = tmp[6];
@@ -294,7 +327,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 4, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -310,7 +343,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 4, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[4];
         p[1] = tmp[5];
@@ -328,7 +361,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 5, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -345,7 +378,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 5, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[3];
         p[1] = tmp[4];
@@ -364,7 +397,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 6, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -382,7 +415,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 6, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[2];
         p[1] = tmp[3];
@@ -402,7 +435,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 7, order::l
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::little>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::little>()( tmp, v );
 
         p[0] = tmp[0];
         p[1] = tmp[1];
@@ -421,7 +454,7 @@ template<class T, order Order> struct endian_store_impl<T, 8, Order, 7, order::b
         BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value || std::is_enum<T>::value );
 
         unsigned char tmp[ 8 ];
-        boost::endian::endian_store<T, 8, order::big>( tmp, v );
+        endian_store_impl<T, 8, order::native, 8, order::big>()( tmp, v );
 
         p[0] = tmp[1];
         p[1] = tmp[2];
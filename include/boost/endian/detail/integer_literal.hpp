@@ -0,0 +1,88 @@
+#ifndef BOOST_ENDIAN_DETAIL_INTEGER_LITERAL_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_INTEGER_LITERAL_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace detail
+{
+
+// The value of the characters of an integer literal, as passed to a literal
+// operator template, computed at compile time so that a value that doesn't
+// fit can be rejected instead of wrapping around. Characters that aren't
+// digits of the base, such as those of a floating literal, make the literal
+// invalid.
+
+BOOST_CONSTEXPR inline unsigned integer_literal_digit( char c )
+{
+    return c >= '0' && c <= '9'? static_cast<unsigned>( c - '0' ):
+        c >= 'a' && c <= 'f'? static_cast<unsigned>( c - 'a' + 10 ):
+        c >= 'A' && c <= 'F'? static_cast<unsigned>( c - 'A' + 10 ): 255;
+}
+
+template<unsigned long long V, bool Valid, unsigned B, char... C> struct integer_literal_digits
+{
+    static const unsigned long long value = V;
+    static const bool valid = Valid;
+};
+
+template<unsigned long long V, bool Valid, unsigned B, char C1, char... C> struct integer_literal_digits<V, Valid, B, C1, C...>:
+    integer_literal_digits<
+        V * B + integer_literal_digit( C1 ),
+        Valid && integer_literal_digit( C1 ) < B && V <= ( ~0ull - integer_literal_digit( C1 ) ) / B,
+        B, C...>
+{
+};
+
+// digit separators
+
+template<unsigned long long V, bool Valid, unsigned B, char... C> struct integer_literal_digits<V, Valid, B, '\'', C...>:
+    integer_literal_digits<V, Valid, B, C...>
+{
+};
+
+template<char... C> struct integer_literal: integer_literal_digits<0, true, 10, C...>
+{
+};
+
+template<char... C> struct integer_literal<'0', C...>: integer_literal_digits<0, true, 8, C...>
+{
+};
+
+template<char... C> struct integer_literal<'0', 'x', C...>: integer_literal_digits<0, true, 16, C...>
+{
+};
+
+template<char... C> struct integer_literal<'0', 'X', C...>: integer_literal_digits<0, true, 16, C...>
+{
+};
+
+template<char... C> struct integer_literal<'0', 'b', C...>: integer_literal_digits<0, true, 2, C...>
+{
+};
+
+template<char... C> struct integer_literal<'0', 'B', C...>: integer_literal_digits<0, true, 2, C...>
+{
+};
+
+// whether the literal is an integer that fits in Bits bits
+
+template<std::size_t Bits, char... C> struct integer_literal_fits
+{
+    static const bool value = integer_literal<C...>::valid && integer_literal<C...>::value <= ( ~0ull >> ( 64 - Bits ) );
+};
+
+} // namespace detail
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DETAIL_INTEGER_LITERAL_HPP_INCLUDED
@@ -18,7 +18,24 @@
   #define __has_builtin(x) 0  // Compatibility with non-clang compilers
 #endif
 
-#if defined(_MSC_VER) && ( !defined(__clang__) || defined(__c2__) )
+#if defined(__has_include)
+# if __has_include(<version>)
+#  include <version>
+# endif
+#endif
+
+#if defined(__cpp_lib_byteswap) && __cpp_lib_byteswap >= 202110L
+//  C++23 std::byteswap is constexpr, and all standard libraries implement it in
+//  terms of the platform intrinsics below, so prefer it when available
+# define BOOST_ENDIAN_INTRINSIC_MSG "std::byteswap"
+# include <bit>
+# define BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_2(x) std::byteswap(x)
+# define BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_4(x) std::byteswap(x)
+# define BOOST_ENDIAN_INTRINSIC_BYTE_SWAP_8(x) std::byteswap(x)
+
+# define BOOST_ENDIAN_CONSTEXPR_INTRINSICS
+
+#elif defined(_MSC_VER) && ( !defined(__clang__) || defined(__c2__) )
 //  Microsoft documents these as being compatible since Windows 95 and specifically
 //  lists runtime library support since Visual Studio 2003 (aka 7.1).
 //  Clang/c2 uses the Microsoft rather than GCC intrinsics, so we check for
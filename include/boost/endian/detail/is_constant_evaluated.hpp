@@ -0,0 +1,32 @@
+#ifndef BOOST_ENDIAN_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <type_traits>
+
+#if defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+# define BOOST_ENDIAN_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+// endian_load and endian_store need std::bit_cast in addition
+// to std::is_constant_evaluated in order to be constexpr
+
+#if defined(BOOST_ENDIAN_HAS_IS_CONSTANT_EVALUATED) && defined(__has_include)
+# if __has_include(<bit>)
+#  include <bit>
+#  if defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L
+#   define BOOST_ENDIAN_CONSTEXPR_LOAD_STORE
+#  endif
+# endif
+#endif
+
+#if defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+# define BOOST_ENDIAN_CXX20_CONSTEXPR constexpr
+#else
+# define BOOST_ENDIAN_CXX20_CONSTEXPR
+#endif
+
+#endif  // BOOST_ENDIAN_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
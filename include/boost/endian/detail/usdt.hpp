@@ -0,0 +1,92 @@
+#ifndef BOOST_ENDIAN_DETAIL_USDT_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_USDT_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// USDT probes boost_endian:batch_entry and boost_endian:batch_exit around
+// the bulk conversion kernels, enabled by defining BOOST_ENDIAN_ENABLE_USDT.
+// The probe arguments are the kernel id, the element width in bytes and
+// the element count. When BOOST_ENDIAN_ENABLE_USDT is not defined, the
+// probe macro expands to nothing.
+
+#include <boost/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_ENDIAN_ENABLE_USDT)
+# include <sys/sdt.h>
+#endif
+
+namespace boost
+{
+namespace endian
+{
+namespace detail
+{
+
+// Kernel ids, as passed in the first probe argument; existing values
+// must not change
+
+enum usdt_kernel
+{
+    usdt_load_n = 1,
+    usdt_store_n = 2,
+    usdt_reverse_inplace_n = 3,
+    usdt_load_delta_n = 4,
+    usdt_store_delta_n = 5,
+    usdt_load_offset_n = 6,
+    usdt_store_offset_n = 7,
+    usdt_reverse_records_n = 8,
+    usdt_convert_records_n = 9,
+    usdt_byte_shuffle_n = 10,
+    usdt_byte_unshuffle_n = 11,
+    usdt_pcm_to_float_n = 12,
+    usdt_float_to_pcm_n = 13
+};
+
+#if defined(BOOST_ENDIAN_ENABLE_USDT)
+
+// fires batch_entry on construction and batch_exit on destruction, so that
+// early returns are covered
+
+class usdt_batch_scope
+{
+private:
+
+    int kernel_;
+    std::size_t width_;
+    std::size_t count_;
+
+public:
+
+    usdt_batch_scope( int kernel, std::size_t width, std::size_t count ) BOOST_NOEXCEPT:
+        kernel_( kernel ), width_( width ), count_( count )
+    {
+        STAP_PROBE3( boost_endian, batch_entry, kernel_, width_, count_ );
+    }
+
+    ~usdt_batch_scope()
+    {
+        STAP_PROBE3( boost_endian, batch_exit, kernel_, width_, count_ );
+    }
+
+    BOOST_DELETED_FUNCTION( usdt_batch_scope( usdt_batch_scope const& ) )
+    BOOST_DELETED_FUNCTION( usdt_batch_scope& operator=( usdt_batch_scope const& ) )
+};
+
+# define BOOST_ENDIAN_USDT_BATCH(kernel, width, count) \
+    ::boost::endian::detail::usdt_batch_scope boost_endian_usdt_batch_scope( ::boost::endian::detail::kernel, width, count )
+
+#else
+
+# define BOOST_ENDIAN_USDT_BATCH(kernel, width, count) ((void)0)
+
+#endif
+
+} // namespace detail
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DETAIL_USDT_HPP_INCLUDED
@@ -0,0 +1,177 @@
+#ifndef BOOST_ENDIAN_FRAME_HPP_INCLUDED
+#define BOOST_ENDIAN_FRAME_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/record.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  "Receiver makes right" framing: the producer writes the payload in its
+//  native byte order and records that order in the frame header; the
+//  receiver converts only when its native order differs.
+//
+//  A frame header is 8 bytes: the byte order mark 0xFEFF, a schema id of 16
+//  bits and the payload size in bytes, 32 bits, all in the producer's byte
+//  order. The payload follows.
+
+namespace boost
+{
+namespace endian
+{
+
+  BOOST_CONSTEXPR_OR_CONST std::size_t frame_header_size = 8;
+
+  struct frame_header
+  {
+      order byte_order;         //  the byte order of the producer
+      std::uint16_t schema;
+      std::uint32_t size;       //  of the payload, in bytes
+  };
+
+  //  Effects: stores at p a frame header in the native byte order
+  void store_frame_header( unsigned char * p, std::uint16_t schema, std::uint32_t size ) BOOST_NOEXCEPT;
+
+  //  Returns: false when n < frame_header_size, the byte order mark is not
+  //           recognized, or the payload does not fit in the n bytes at p
+  bool load_frame_header( unsigned char const * p, std::size_t n, frame_header & h ) BOOST_NOEXCEPT;
+
+  //  Returns: frame_header_size + n * Layout::size
+  template<class Layout>
+    BOOST_CONSTEXPR std::size_t record_frame_size( std::size_t n ) BOOST_NOEXCEPT;
+
+  //  Effects: stores at p a frame holding the n records of Layout at records,
+  //           whose fields are in the native byte order, unconverted
+  template<class Layout>
+    void store_record_frame( unsigned char * p, void const * records, std::size_t n,
+      std::uint16_t schema ) BOOST_NOEXCEPT;
+
+  //  Effects: converts the records of the frame at p to the native byte
+  //           order in place, when they are in the other one
+  template<class Layout>
+    bool load_record_frame( unsigned char * p, std::size_t n, frame_header & h ) BOOST_NOEXCEPT;
+
+  //  Effects: stores the records of the frame at p, converted to the native
+  //           byte order, in out, which has room for capacity records
+  template<class Layout>
+    bool load_record_frame( unsigned char const * p, std::size_t n, void * out,
+      std::size_t capacity, frame_header & h ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+inline void store_frame_header( unsigned char * p, std::uint16_t schema, std::uint32_t size ) BOOST_NOEXCEPT
+{
+    boost::endian::endian_store<std::uint16_t, 2, order::native>( p, 0xFEFF );
+    boost::endian::endian_store<std::uint16_t, 2, order::native>( p + 2, schema );
+    boost::endian::endian_store<std::uint32_t, 4, order::native>( p + 4, size );
+}
+
+inline bool load_frame_header( unsigned char const * p, std::size_t n, frame_header & h ) BOOST_NOEXCEPT
+{
+    if( n < frame_header_size ) return false;
+
+    if( p[ 0 ] == 0xFE && p[ 1 ] == 0xFF )
+    {
+        h.byte_order = order::big;
+    }
+    else if( p[ 0 ] == 0xFF && p[ 1 ] == 0xFE )
+    {
+        h.byte_order = order::little;
+    }
+    else
+    {
+        return false;
+    }
+
+    h.schema = boost::endian::conditional_reverse( boost::endian::endian_load<std::uint16_t, 2, order::native>( p + 2 ), h.byte_order, order::native );
+    h.size = boost::endian::conditional_reverse( boost::endian::endian_load<std::uint32_t, 4, order::native>( p + 4 ), h.byte_order, order::native );
+
+    return h.size <= n - frame_header_size;
+}
+
+template<class Layout>
+inline BOOST_CONSTEXPR std::size_t record_frame_size( std::size_t n ) BOOST_NOEXCEPT
+{
+    return frame_header_size + n * Layout::size;
+}
+
+// Requires:
+//
+//    n * Layout::size <= 0xFFFFFFFF
+//    [p, p + record_frame_size<Layout>( n ) ) and the records do not overlap
+
+template<class Layout>
+inline void store_record_frame( unsigned char * p, void const * records, std::size_t n,
+    std::uint16_t schema ) BOOST_NOEXCEPT
+{
+    std::size_t const size = n * Layout::size;
+
+    boost::endian::store_frame_header( p, schema, static_cast<std::uint32_t>( size ) );
+
+    if( size != 0 )
+    {
+        std::memcpy( p + frame_header_size, records, size );
+    }
+}
+
+// Returns: false when load_frame_header( p, n, h ) fails, or the payload
+//          is not a whole number of records; the frame is then unchanged
+//
+// Postconditions: the header at p is in the native byte order, so that
+//                 the frame can be loaded again; h.byte_order is the
+//                 byte order of the producer
+
+template<class Layout>
+inline bool load_record_frame( unsigned char * p, std::size_t n, frame_header & h ) BOOST_NOEXCEPT
+{
+    if( !boost::endian::load_frame_header( p, n, h ) || h.size % Layout::size != 0 ) return false;
+
+    if( h.byte_order != order::native )
+    {
+        unsigned char * q = p + frame_header_size;
+        boost::endian::endian_convert_records_n<Layout>( q, q, h.size / Layout::size, h.byte_order, order::native );
+
+        boost::endian::store_frame_header( p, h.schema, h.size );
+    }
+
+    return true;
+}
+
+// Requires: [out, out + capacity * Layout::size) and [p, p + n) do not overlap
+//
+// Returns: false when load_frame_header( p, n, h ) fails, the payload is
+//          not a whole number of records, or there are more than capacity
+//          records; out is then unchanged
+
+template<class Layout>
+inline bool load_record_frame( unsigned char const * p, std::size_t n, void * out,
+    std::size_t capacity, frame_header & h ) BOOST_NOEXCEPT
+{
+    if( !boost::endian::load_frame_header( p, n, h ) || h.size % Layout::size != 0 || h.size / Layout::size > capacity ) return false;
+
+    boost::endian::endian_convert_records_n<Layout>( static_cast<unsigned char*>( out ), p + frame_header_size, h.size / Layout::size, h.byte_order, order::native );
+
+    return true;
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_FRAME_HPP_INCLUDED
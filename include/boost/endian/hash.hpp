@@ -0,0 +1,173 @@
+#ifndef BOOST_ENDIAN_HASH_HPP_INCLUDED
+#define BOOST_ENDIAN_HASH_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <functional>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  Hashes of endian_buffer and endian_arithmetic objects are computed from
+  //  the stored bytes, without converting them to T, and are the same on all
+  //  hosts regardless of their byte order. T must be integral or an enumeration.
+
+  //  Returns: a hash of the n_bits/8 bytes at p
+  template<std::size_t N>
+    std::size_t endian_hash_bytes( unsigned char const * p ) BOOST_NOEXCEPT;
+
+  //  Returns: endian_hash_bytes<n_bits/8>( x.data() )
+  template<order Order, class T, std::size_t n_bits, align A>
+    std::size_t hash_value( endian_buffer<Order, T, n_bits, A> const & x ) BOOST_NOEXCEPT;
+  template<order Order, class T, std::size_t n_bits, align A>
+    std::size_t hash_value( endian_arithmetic<Order, T, n_bits, A> const & x ) BOOST_NOEXCEPT;
+
+  //  Effects: out[i] = hash_value( first[i] ), i < n
+  template<class E>
+    void endian_hash_n( E const * first, std::size_t n, std::size_t * out ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+namespace std
+{
+
+  template<boost::endian::order Order, class T, std::size_t n_bits, boost::endian::align A>
+    struct hash< boost::endian::endian_buffer<Order, T, n_bits, A> >;
+  template<boost::endian::order Order, class T, std::size_t n_bits, boost::endian::align A>
+    struct hash< boost::endian::endian_arithmetic<Order, T, n_bits, A> >;
+
+} // namespace std
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// MurmurHash3 64-bit finalizer
+
+inline std::uint64_t endian_hash_mix( std::uint64_t x ) BOOST_NOEXCEPT
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+
+    return x;
+}
+
+// The bytes are read as a little-endian integer, which is a plain load
+// on little-endian hosts and gives the same result on big-endian ones
+
+template<std::size_t N> inline std::uint64_t endian_hash_bytes_64( unsigned char const * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= 8 );
+
+    std::uint64_t x = boost::endian::endian_load<std::uint64_t, N, order::little>( p );
+    return endian_hash_mix( x + N );
+}
+
+template<class T> struct is_endian_hashable: std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value>
+{
+};
+
+} // namespace detail
+
+template<std::size_t N>
+inline std::size_t endian_hash_bytes( unsigned char const * p ) BOOST_NOEXCEPT
+{
+    return static_cast<std::size_t>( detail::endian_hash_bytes_64<N>( p ) );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::size_t hash_value( endian_buffer<Order, T, n_bits, A> const & x ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_hashable<T>::value );
+    return boost::endian::endian_hash_bytes<n_bits / 8>( x.data() );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::size_t hash_value( endian_arithmetic<Order, T, n_bits, A> const & x ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_hashable<T>::value );
+    return boost::endian::endian_hash_bytes<n_bits / 8>( x.data() );
+}
+
+template<class E>
+inline void endian_hash_n( E const * first, std::size_t n, std::size_t * out ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        out[ i ] = hash_value( first[ i ] );
+    }
+}
+
+namespace detail
+{
+
+// std::hash is disabled for value types for which operator== and the
+// stored bytes disagree, such as floating point
+
+template<class E, class T, bool H = is_endian_hashable<T>::value> struct endian_std_hash
+{
+    endian_std_hash() = delete;
+    endian_std_hash( endian_std_hash const& ) = delete;
+    endian_std_hash& operator=( endian_std_hash const& ) = delete;
+};
+
+template<class E, class T> struct endian_std_hash<E, T, true>
+{
+    typedef E argument_type;
+    typedef std::size_t result_type;
+
+    std::size_t operator()( E const & x ) const BOOST_NOEXCEPT
+    {
+        return hash_value( x );
+    }
+};
+
+} // namespace detail
+
+} // namespace endian
+} // namespace boost
+
+namespace std
+{
+
+template<boost::endian::order Order, class T, std::size_t n_bits, boost::endian::align A>
+struct hash< boost::endian::endian_buffer<Order, T, n_bits, A> >:
+    boost::endian::detail::endian_std_hash< boost::endian::endian_buffer<Order, T, n_bits, A>, T >
+{
+};
+
+template<boost::endian::order Order, class T, std::size_t n_bits, boost::endian::align A>
+struct hash< boost::endian::endian_arithmetic<Order, T, n_bits, A> >:
+    boost::endian::detail::endian_std_hash< boost::endian::endian_arithmetic<Order, T, n_bits, A>, T >
+{
+};
+
+} // namespace std
+
+#endif  // BOOST_ENDIAN_HASH_HPP_INCLUDED
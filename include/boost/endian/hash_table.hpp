@@ -0,0 +1,340 @@
+#ifndef BOOST_ENDIAN_HASH_TABLE_HPP_INCLUDED
+#define BOOST_ENDIAN_HASH_TABLE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/hash.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/is_trivially_copyable.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  Open addressing hash tables stored in a byte region whose contents do not
+//  depend on the host, so that a table built on one machine can be written
+//  to a file, mapped on another, and queried in place. Key is an endian_buffer
+//  or endian_arithmetic type of at most 8 bytes whose value type is integral
+//  or an enumeration; Value is a trivially copyable type, typically an
+//  endian_buffer or a structure of them.
+//
+//  Keys are hashed and compared in their stored form, so a lookup converts
+//  neither the probe key nor the keys in the table.
+
+namespace boost
+{
+namespace endian
+{
+
+  //  builds a table in a std::vector<unsigned char>
+  template<class Key, class Value> class endian_hash_table_builder;
+
+  //  queries a table in [p, p + n)
+  template<class Key, class Value> class endian_hash_table_view;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// A table consists of a header of little-endian fields
+//
+//   0  8  bucket count, a power of two
+//   8  8  number of entries
+//  16  4  key size
+//  20  4  value size
+//
+// followed by one control byte per bucket, 0 for an empty bucket and
+// 0x80 | the top 7 bits of the hash otherwise, the keys, and the values
+
+BOOST_CONSTEXPR_OR_CONST std::size_t hash_table_header_size = 24;
+
+template<std::size_t KeySize, std::size_t ValueSize> struct hash_table_layout
+{
+    static std::size_t storage_size( std::size_t buckets ) BOOST_NOEXCEPT
+    {
+        return hash_table_header_size + buckets * ( 1 + KeySize + ValueSize );
+    }
+
+    static std::size_t key_offset( std::size_t buckets ) BOOST_NOEXCEPT
+    {
+        return hash_table_header_size + buckets;
+    }
+
+    static std::size_t value_offset( std::size_t buckets ) BOOST_NOEXCEPT
+    {
+        return hash_table_header_size + buckets * ( 1 + KeySize );
+    }
+
+    static unsigned char tag( std::uint64_t h ) BOOST_NOEXCEPT
+    {
+        return static_cast<unsigned char>( 0x80 | h >> 57 );
+    }
+
+    // Linear probing from the bucket given by the low bits of h. Returns
+    // whether the key is present; i is its bucket, or the empty bucket that
+    // ends the probe sequence, or buckets when the table has no empty bucket
+
+    static bool find( unsigned char const * p, std::size_t buckets, unsigned char const * key, std::uint64_t h, std::size_t & i ) BOOST_NOEXCEPT
+    {
+        unsigned char const * control = p + hash_table_header_size;
+        unsigned char const * keys = p + key_offset( buckets );
+
+        unsigned char const t = tag( h );
+        std::size_t const mask = buckets - 1;
+
+        i = static_cast<std::size_t>( h ) & mask;
+
+        for( std::size_t k = 0; k < buckets; ++k, i = ( i + 1 ) & mask )
+        {
+            unsigned char c = control[ i ];
+
+            if( c == 0 ) return false;
+            if( c == t && std::memcmp( keys + i * KeySize, key, KeySize ) == 0 ) return true;
+        }
+
+        i = buckets;
+        return false;
+    }
+};
+
+} // namespace detail
+
+//  endian_hash_table_builder  ---------------------------------------------------------//
+
+template<class Key, class Value> class endian_hash_table_builder
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_hashable<typename Key::value_type>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<Value>::value );
+
+    typedef detail::hash_table_layout<sizeof(Key), sizeof(Value)> layout;
+
+    std::vector<unsigned char> data_;
+    std::size_t buckets_;
+    std::size_t size_;
+
+private:
+
+    // at most 3/4 of the buckets are used
+
+    static std::size_t buckets_for( std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::size_t r = 8;
+        while( r / 4 * 3 < n ) r *= 2;
+        return r;
+    }
+
+    void allocate( std::size_t buckets )
+    {
+        data_.assign( layout::storage_size( buckets ), 0 );
+        buckets_ = buckets;
+
+        unsigned char * p = &data_[ 0 ];
+
+        endian_store<std::uint64_t, 8, order::little>( p, buckets );
+        endian_store<std::uint64_t, 8, order::little>( p + 8, size_ );
+        endian_store<std::uint32_t, 4, order::little>( p + 16, sizeof(Key) );
+        endian_store<std::uint32_t, 4, order::little>( p + 20, sizeof(Value) );
+    }
+
+    // i is the empty bucket returned by layout::find
+
+    void place( std::size_t i, std::uint64_t h, unsigned char const * key, void const * value ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = &data_[ 0 ];
+
+        p[ detail::hash_table_header_size + i ] = layout::tag( h );
+        std::memcpy( p + layout::key_offset( buckets_ ) + i * sizeof(Key), key, sizeof(Key) );
+        std::memcpy( p + layout::value_offset( buckets_ ) + i * sizeof(Value), value, sizeof(Value) );
+    }
+
+    void rehash( std::size_t buckets )
+    {
+        std::vector<unsigned char> old;
+        old.swap( data_ );
+
+        std::size_t const n = buckets_;
+
+        allocate( buckets );
+
+        unsigned char const * p = &old[ 0 ];
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            if( p[ detail::hash_table_header_size + j ] == 0 ) continue;
+
+            unsigned char const * key = p + layout::key_offset( n ) + j * sizeof(Key);
+            std::uint64_t h = detail::endian_hash_bytes_64<sizeof(Key)>( key );
+
+            std::size_t i;
+            layout::find( &data_[ 0 ], buckets_, key, h, i );
+
+            place( i, h, key, p + layout::value_offset( n ) + j * sizeof(Value) );
+        }
+    }
+
+public:
+
+    typedef Key key_type;
+    typedef Value mapped_type;
+
+    //  Effects: reserves space for n entries
+
+    explicit endian_hash_table_builder( std::size_t n = 0 ): buckets_( 0 ), size_( 0 )
+    {
+        allocate( buckets_for( n ) );
+    }
+
+    //  Effects: adds an entry for k with the value v, unless one is present
+    //  Returns: whether the entry was added
+
+    bool insert( Key const & k, Value const & v )
+    {
+        unsigned char const * key = k.data();
+        std::uint64_t h = detail::endian_hash_bytes_64<sizeof(Key)>( key );
+
+        std::size_t i;
+
+        if( layout::find( &data_[ 0 ], buckets_, key, h, i ) ) return false;
+
+        if( size_ >= buckets_ / 4 * 3 )
+        {
+            rehash( buckets_ * 2 );
+            layout::find( &data_[ 0 ], buckets_, key, h, i );
+        }
+
+        place( i, h, key, &v );
+
+        ++size_;
+        endian_store<std::uint64_t, 8, order::little>( &data_[ 8 ], size_ );
+
+        return true;
+    }
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+
+    std::size_t bucket_count() const BOOST_NOEXCEPT
+    {
+        return buckets_;
+    }
+
+    //  Returns: the table, storage_size() bytes
+
+    unsigned char const * data() const BOOST_NOEXCEPT
+    {
+        return &data_[ 0 ];
+    }
+
+    std::size_t storage_size() const BOOST_NOEXCEPT
+    {
+        return data_.size();
+    }
+};
+
+//  endian_hash_table_view  ------------------------------------------------------------//
+
+//  A view of a table that fails validation is empty, and valid() returns false.
+//  When Key or Value have an alignment greater than 1, p must be aligned to 8.
+
+template<class Key, class Value> class endian_hash_table_view
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_endian_hashable<typename Key::value_type>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<Value>::value );
+
+    typedef detail::hash_table_layout<sizeof(Key), sizeof(Value)> layout;
+
+    unsigned char const * p_;
+    std::size_t buckets_;
+    std::size_t size_;
+
+public:
+
+    typedef Key key_type;
+    typedef Value mapped_type;
+
+    endian_hash_table_view() BOOST_NOEXCEPT: p_( 0 ), buckets_( 0 ), size_( 0 )
+    {
+    }
+
+    endian_hash_table_view( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT: p_( 0 ), buckets_( 0 ), size_( 0 )
+    {
+        if( n < detail::hash_table_header_size ) return;
+
+        std::uint64_t buckets = endian_load<std::uint64_t, 8, order::little>( p );
+        std::uint64_t size = endian_load<std::uint64_t, 8, order::little>( p + 8 );
+
+        if( endian_load<std::uint32_t, 4, order::little>( p + 16 ) != sizeof(Key) ) return;
+        if( endian_load<std::uint32_t, 4, order::little>( p + 20 ) != sizeof(Value) ) return;
+
+        if( buckets == 0 || ( buckets & ( buckets - 1 ) ) != 0 || size >= buckets ) return;
+
+        std::size_t const m = ( n - detail::hash_table_header_size ) / ( 1 + sizeof(Key) + sizeof(Value) );
+        if( buckets > m ) return;
+
+        p_ = p;
+        buckets_ = static_cast<std::size_t>( buckets );
+        size_ = static_cast<std::size_t>( size );
+    }
+
+    bool valid() const BOOST_NOEXCEPT
+    {
+        return p_ != 0;
+    }
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+
+    std::size_t bucket_count() const BOOST_NOEXCEPT
+    {
+        return buckets_;
+    }
+
+    //  Returns: a pointer to the value stored for k, or a null pointer
+
+    Value const * find( Key const & k ) const BOOST_NOEXCEPT
+    {
+        if( p_ == 0 ) return 0;
+
+        unsigned char const * key = k.data();
+        std::size_t i;
+
+        if( !layout::find( p_, buckets_, key, detail::endian_hash_bytes_64<sizeof(Key)>( key ), i ) ) return 0;
+
+        return reinterpret_cast<Value const*>( p_ + layout::value_offset( buckets_ ) + i * sizeof(Value) );
+    }
+
+    bool contains( Key const & k ) const BOOST_NOEXCEPT
+    {
+        return find( k ) != 0;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_HASH_TABLE_HPP_INCLUDED
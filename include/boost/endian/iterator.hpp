@@ -0,0 +1,303 @@
+#ifndef BOOST_ENDIAN_ITERATOR_HPP_INCLUDED
+#define BOOST_ENDIAN_ITERATOR_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  writes each assigned value as N bytes in byte order Order
+  template<class T, order Order, std::size_t N = sizeof(T)>
+    class endian_output_iterator;
+
+  //  reads N-byte values in byte order Order
+  template<class T, order Order, std::size_t N = sizeof(T)>
+    class endian_input_iterator;
+
+  template<class T, std::size_t N = sizeof(T)>
+    using big_output_iterator = endian_output_iterator<T, order::big, N>;
+  template<class T, std::size_t N = sizeof(T)>
+    using little_output_iterator = endian_output_iterator<T, order::little, N>;
+
+  template<class T, std::size_t N = sizeof(T)>
+    using big_input_iterator = endian_input_iterator<T, order::big, N>;
+  template<class T, std::size_t N = sizeof(T)>
+    using little_input_iterator = endian_input_iterator<T, order::little, N>;
+
+  //  As std::copy. When copying from a contiguous range of T into an
+  //  endian_output_iterator<T, Order>, or from an endian_input_iterator<T, Order>
+  //  range into a contiguous range of T, uses endian_store_n/endian_load_n.
+  template<class InputIt, class OutputIt>
+    OutputIt endian_copy( InputIt first, InputIt last, OutputIt out );
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+template<class T, order Order, std::size_t N>
+class endian_output_iterator
+{
+private:
+
+    unsigned char * p_;
+
+public:
+
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    explicit endian_output_iterator( unsigned char * p ) BOOST_NOEXCEPT: p_( p )
+    {
+    }
+
+    endian_output_iterator& operator=( T const & v ) BOOST_NOEXCEPT
+    {
+        boost::endian::endian_store<T, N, Order>( p_, v );
+        p_ += N;
+
+        return *this;
+    }
+
+    endian_output_iterator& operator*() BOOST_NOEXCEPT
+    {
+        return *this;
+    }
+
+    endian_output_iterator& operator++() BOOST_NOEXCEPT
+    {
+        return *this;
+    }
+
+    endian_output_iterator& operator++( int ) BOOST_NOEXCEPT
+    {
+        return *this;
+    }
+
+    //  Returns: a pointer past the last byte written
+
+    unsigned char * base() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+};
+
+//  Values are returned by value, so the iterator is formally an input iterator,
+//  but it supports the random access operations.
+
+template<class T, order Order, std::size_t N>
+class endian_input_iterator
+{
+private:
+
+    unsigned char const * p_;
+
+public:
+
+    typedef std::input_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef T reference;
+
+    endian_input_iterator() BOOST_NOEXCEPT: p_( 0 )
+    {
+    }
+
+    explicit endian_input_iterator( unsigned char const * p ) BOOST_NOEXCEPT: p_( p )
+    {
+    }
+
+    T operator*() const BOOST_NOEXCEPT
+    {
+        return boost::endian::endian_load<T, N, Order>( p_ );
+    }
+
+    T operator[]( difference_type i ) const BOOST_NOEXCEPT
+    {
+        return boost::endian::endian_load<T, N, Order>( p_ + i * static_cast<difference_type>( N ) );
+    }
+
+    endian_input_iterator& operator++() BOOST_NOEXCEPT
+    {
+        p_ += N;
+        return *this;
+    }
+
+    endian_input_iterator operator++( int ) BOOST_NOEXCEPT
+    {
+        endian_input_iterator tmp( *this );
+        p_ += N;
+        return tmp;
+    }
+
+    endian_input_iterator& operator--() BOOST_NOEXCEPT
+    {
+        p_ -= N;
+        return *this;
+    }
+
+    endian_input_iterator operator--( int ) BOOST_NOEXCEPT
+    {
+        endian_input_iterator tmp( *this );
+        p_ -= N;
+        return tmp;
+    }
+
+    endian_input_iterator& operator+=( difference_type i ) BOOST_NOEXCEPT
+    {
+        p_ += i * static_cast<difference_type>( N );
+        return *this;
+    }
+
+    endian_input_iterator& operator-=( difference_type i ) BOOST_NOEXCEPT
+    {
+        p_ -= i * static_cast<difference_type>( N );
+        return *this;
+    }
+
+    friend endian_input_iterator operator+( endian_input_iterator it, difference_type i ) BOOST_NOEXCEPT
+    {
+        return it += i;
+    }
+
+    friend endian_input_iterator operator-( endian_input_iterator it, difference_type i ) BOOST_NOEXCEPT
+    {
+        return it -= i;
+    }
+
+    friend difference_type operator-( endian_input_iterator const & a, endian_input_iterator const & b ) BOOST_NOEXCEPT
+    {
+        return ( a.p_ - b.p_ ) / static_cast<difference_type>( N );
+    }
+
+    friend bool operator==( endian_input_iterator const & a, endian_input_iterator const & b ) BOOST_NOEXCEPT
+    {
+        return a.p_ == b.p_;
+    }
+
+    friend bool operator!=( endian_input_iterator const & a, endian_input_iterator const & b ) BOOST_NOEXCEPT
+    {
+        return a.p_ != b.p_;
+    }
+
+    friend bool operator<( endian_input_iterator const & a, endian_input_iterator const & b ) BOOST_NOEXCEPT
+    {
+        return a.p_ < b.p_;
+    }
+
+    unsigned char const * base() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+};
+
+namespace detail
+{
+
+// is_contiguous_iterator
+
+template<class It> struct is_contiguous_iterator: std::is_pointer<It>
+{
+};
+
+#if defined(__cpp_lib_concepts) && __cpp_lib_concepts >= 202002L
+
+template<class It> requires std::contiguous_iterator<It> struct is_contiguous_iterator<It>: std::true_type
+{
+};
+
+template<class It> inline auto to_address( It it ) BOOST_NOEXCEPT
+{
+    return std::to_address( it );
+}
+
+#else
+
+template<class T> inline T * to_address( T * p ) BOOST_NOEXCEPT
+{
+    return p;
+}
+
+#endif
+
+template<class It, class T, bool C = is_contiguous_iterator<It>::value> struct is_contiguous_range_of: std::false_type
+{
+};
+
+template<class It, class T> struct is_contiguous_range_of<It, T, true>: std::is_same<typename std::remove_cv<typename std::iterator_traits<It>::value_type>::type, T>
+{
+};
+
+template<class It, class Out, class E = void> struct endian_copy_impl
+{
+    static Out call( It first, It last, Out out )
+    {
+        return std::copy( first, last, out );
+    }
+};
+
+// contiguous T -> endian_output_iterator
+
+template<class It, class T, order Order> struct endian_copy_impl<It, endian_output_iterator<T, Order, sizeof(T)>,
+    typename std::enable_if< is_contiguous_range_of<It, T>::value >::type>
+{
+    typedef endian_output_iterator<T, Order, sizeof(T)> Out;
+
+    static Out call( It first, It last, Out out ) BOOST_NOEXCEPT
+    {
+        std::size_t n = static_cast<std::size_t>( last - first );
+
+        if( n == 0 ) return out;
+
+        boost::endian::endian_store_n<T, Order>( detail::to_address( first ), n, out.base() );
+        return Out( out.base() + n * sizeof(T) );
+    }
+};
+
+// endian_input_iterator -> contiguous T
+
+template<class T, order Order, class Out> struct endian_copy_impl<endian_input_iterator<T, Order, sizeof(T)>, Out,
+    typename std::enable_if< is_contiguous_range_of<Out, T>::value && !std::is_const<typename std::remove_pointer<Out>::type>::value >::type>
+{
+    typedef endian_input_iterator<T, Order, sizeof(T)> It;
+
+    static Out call( It first, It last, Out out ) BOOST_NOEXCEPT
+    {
+        std::size_t n = static_cast<std::size_t>( last - first );
+
+        if( n == 0 ) return out;
+
+        boost::endian::endian_load_n<T, Order>( first.base(), n, detail::to_address( out ) );
+        return out + static_cast<std::ptrdiff_t>( n );
+    }
+};
+
+} // namespace detail
+
+template<class InputIt, class OutputIt>
+inline OutputIt endian_copy( InputIt first, InputIt last, OutputIt out )
+{
+    return detail::endian_copy_impl<InputIt, OutputIt>::call( first, last, out );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_ITERATOR_HPP_INCLUDED
@@ -0,0 +1,16 @@
+#ifndef BOOST_ENDIAN_NET_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/ethernet.hpp>
+#include <boost/endian/net/ipv4.hpp>
+#include <boost/endian/net/ipv6.hpp>
+#include <boost/endian/net/tcp.hpp>
+#include <boost/endian/net/udp.hpp>
+#include <boost/endian/net/checksum.hpp>
+
+#endif  // BOOST_ENDIAN_NET_HPP_INCLUDED
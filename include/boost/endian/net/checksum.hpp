@@ -0,0 +1,161 @@
+#ifndef BOOST_ENDIAN_NET_CHECKSUM_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_CHECKSUM_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_reverse.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+namespace detail
+{
+
+inline std::uint16_t fold_checksum( std::uint64_t s ) BOOST_NOEXCEPT
+{
+    s = ( s & 0xFFFFFFFFu ) + ( s >> 32 );
+    s = ( s & 0xFFFFFFFFu ) + ( s >> 32 );
+    s = ( s & 0xFFFFu ) + ( s >> 16 );
+    s = ( s & 0xFFFFu ) + ( s >> 16 );
+
+    return static_cast<std::uint16_t>( s );
+}
+
+// Returns: the sum of the m native 32-bit words at p, for m <= 2^31
+
+inline std::uint64_t sum_native_words( unsigned char const * p, std::size_t m ) BOOST_NOEXCEPT
+{
+    std::uint64_t s = 0;
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        std::uint32_t w;
+        std::memcpy( &w, p + i * 4, 4 );
+
+        s += w;
+    }
+
+    return s;
+}
+
+// The ones' complement sum is byte order independent (RFC 1071): summing the
+// data as native words and swapping the folded result once gives the same
+// value as summing big-endian words. The data is summed as 32-bit words into
+// a 64-bit accumulator, in a loop that compilers vectorize. The accumulator
+// would wrap after about 2^32 words, so the words are summed in blocks of
+// 2^31, and the total is folded back below 2^33 after each block; the end
+// around carry leaves the ones' complement sum unchanged.
+
+inline std::uint16_t ones_complement_sum_native( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t const block = static_cast<std::size_t>( 1 ) << 31;
+
+    std::size_t m = n / 4;
+
+    std::uint64_t s = 0;
+
+    while( m > block )
+    {
+        s += sum_native_words( p, block );
+        s = ( s & 0xFFFFFFFFu ) + ( s >> 32 );
+
+        p += block * 4;
+        m -= block;
+    }
+
+    s += sum_native_words( p, m );
+    p += m * 4;
+
+    // the trailing bytes are padded with zeroes, in memory order
+
+    if( n % 4 != 0 )
+    {
+        unsigned char tmp[ 4 ] = {};
+        std::memcpy( tmp, p, n % 4 );
+
+        std::uint32_t w;
+        std::memcpy( &w, tmp, 4 );
+
+        s += w;
+    }
+
+    return fold_checksum( s );
+}
+
+inline std::uint16_t native_to_big_sum( std::uint16_t s, std::true_type ) BOOST_NOEXCEPT
+{
+    return s;
+}
+
+inline std::uint16_t native_to_big_sum( std::uint16_t s, std::false_type ) BOOST_NOEXCEPT
+{
+    return boost::endian::detail::endian_reverse_impl( s );
+}
+
+} // namespace detail
+
+// Requires: when the sum is continued by a later call, n is even
+//
+// Returns: the ones' complement sum of the big-endian 16-bit words in p[0, n),
+//          added to initial; an odd trailing byte is padded with a zero byte
+
+inline std::uint16_t ones_complement_sum( unsigned char const * p, std::size_t n, std::uint16_t initial = 0 ) BOOST_NOEXCEPT
+{
+    std::uint16_t s = detail::native_to_big_sum( detail::ones_complement_sum_native( p, n ), std::integral_constant<bool, order::native == order::big>() );
+    return detail::fold_checksum( static_cast<std::uint64_t>( s ) + initial );
+}
+
+// Returns: the Internet checksum (RFC 1071) of p[0, n), in host byte order;
+//          zero when p[0, n) contains a correct checksum field
+
+inline std::uint16_t internet_checksum( unsigned char const * p, std::size_t n, std::uint16_t initial = 0 ) BOOST_NOEXCEPT
+{
+    return static_cast<std::uint16_t>( ~net::ones_complement_sum( p, n, initial ) );
+}
+
+// Returns: the checksum hc updated for the change of a 16-bit field from
+//          old_value to new_value, without recomputing it (RFC 1624, eqn. 3)
+
+inline std::uint16_t internet_checksum_update( std::uint16_t hc, std::uint16_t old_value, std::uint16_t new_value ) BOOST_NOEXCEPT
+{
+    std::uint64_t s = static_cast<std::uint16_t>( ~hc );
+
+    s += static_cast<std::uint16_t>( ~old_value );
+    s += new_value;
+
+    return static_cast<std::uint16_t>( ~detail::fold_checksum( s ) );
+}
+
+// Returns: the checksum hc updated for the change of a 32-bit field, such
+//          as an IPv4 address, from old_value to new_value
+
+inline std::uint16_t internet_checksum_update32( std::uint16_t hc, std::uint32_t old_value, std::uint32_t new_value ) BOOST_NOEXCEPT
+{
+    std::uint64_t s = static_cast<std::uint16_t>( ~hc );
+
+    s += static_cast<std::uint16_t>( ~( old_value >> 16 ) );
+    s += static_cast<std::uint16_t>( ~old_value );
+    s += new_value >> 16;
+    s += new_value & 0xFFFFu;
+
+    return static_cast<std::uint16_t>( ~detail::fold_checksum( s ) );
+}
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_CHECKSUM_HPP_INCLUDED
@@ -0,0 +1,64 @@
+#ifndef BOOST_ENDIAN_NET_ETHERNET_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_ETHERNET_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/header_cast.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// EtherType values
+
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_ipv4 = 0x0800;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_arp = 0x0806;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_vlan = 0x8100;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_ipv6 = 0x86DD;
+
+// Ethernet II header
+
+struct ethernet_header
+{
+    unsigned char destination[ 6 ];
+    unsigned char source[ 6 ];
+    big_uint16_buf_t ether_type;
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(ethernet_header) == 14 );
+
+// 802.1Q tag, following the source address when ether_type is ether_type_vlan
+
+struct vlan_tag
+{
+    big_uint16_buf_t tci;
+    big_uint16_buf_t ether_type;
+
+    unsigned priority() const BOOST_NOEXCEPT
+    {
+        return tci.value() >> 13;
+    }
+
+    unsigned vlan_id() const BOOST_NOEXCEPT
+    {
+        return tci.value() & 0x0FFF;
+    }
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(vlan_tag) == 4 );
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_ETHERNET_HPP_INCLUDED
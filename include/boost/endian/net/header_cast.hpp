@@ -0,0 +1,39 @@
+#ifndef BOOST_ENDIAN_NET_HEADER_CAST_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_HEADER_CAST_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// The header types consist only of byte arrays and unaligned endian buffers,
+// so they have alignment 1, no padding, and can be overlaid on packet data.
+
+template<class Header> inline Header const * header_cast( unsigned char const * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<Header>::value == 1 );
+    return reinterpret_cast<Header const *>( p );
+}
+
+template<class Header> inline Header * header_cast( unsigned char * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<Header>::value == 1 );
+    return reinterpret_cast<Header *>( p );
+}
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_HEADER_CAST_HPP_INCLUDED
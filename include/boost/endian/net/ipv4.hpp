@@ -0,0 +1,80 @@
+#ifndef BOOST_ENDIAN_NET_IPV4_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_IPV4_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/header_cast.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// IP protocol numbers
+
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_icmp = 1;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_tcp = 6;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_udp = 17;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_icmpv6 = 58;
+
+// IPv4 header (RFC 791), without options
+
+struct ipv4_header
+{
+    big_uint8_buf_t version_ihl;
+    big_uint8_buf_t dscp_ecn;
+    big_uint16_buf_t total_length;
+    big_uint16_buf_t identification;
+    big_uint16_buf_t flags_fragment_offset;
+    big_uint8_buf_t ttl;
+    big_uint8_buf_t protocol;
+    big_uint16_buf_t header_checksum;
+    big_uint32_buf_t source;
+    big_uint32_buf_t destination;
+
+    unsigned version() const BOOST_NOEXCEPT
+    {
+        return version_ihl.value() >> 4;
+    }
+
+    // header length in bytes, including options
+
+    std::size_t header_length() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( version_ihl.value() & 0x0F ) * 4;
+    }
+
+    bool dont_fragment() const BOOST_NOEXCEPT
+    {
+        return ( flags_fragment_offset.value() & 0x4000 ) != 0;
+    }
+
+    bool more_fragments() const BOOST_NOEXCEPT
+    {
+        return ( flags_fragment_offset.value() & 0x2000 ) != 0;
+    }
+
+    // fragment offset in bytes
+
+    std::size_t fragment_offset() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( flags_fragment_offset.value() & 0x1FFF ) * 8;
+    }
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(ipv4_header) == 20 );
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_IPV4_HPP_INCLUDED
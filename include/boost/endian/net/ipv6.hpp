@@ -0,0 +1,55 @@
+#ifndef BOOST_ENDIAN_NET_IPV6_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_IPV6_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/header_cast.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// IPv6 fixed header (RFC 8200)
+
+struct ipv6_header
+{
+    big_uint32_buf_t version_class_flow;
+    big_uint16_buf_t payload_length;
+    big_uint8_buf_t next_header;
+    big_uint8_buf_t hop_limit;
+    unsigned char source[ 16 ];
+    unsigned char destination[ 16 ];
+
+    unsigned version() const BOOST_NOEXCEPT
+    {
+        return version_class_flow.value() >> 28;
+    }
+
+    unsigned traffic_class() const BOOST_NOEXCEPT
+    {
+        return ( version_class_flow.value() >> 20 ) & 0xFF;
+    }
+
+    std::uint32_t flow_label() const BOOST_NOEXCEPT
+    {
+        return version_class_flow.value() & 0xFFFFF;
+    }
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(ipv6_header) == 40 );
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_IPV6_HPP_INCLUDED
@@ -0,0 +1,65 @@
+#ifndef BOOST_ENDIAN_NET_TCP_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_TCP_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/header_cast.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// TCP flags
+
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_fin = 0x001;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_syn = 0x002;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_rst = 0x004;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_psh = 0x008;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_ack = 0x010;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_urg = 0x020;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_ece = 0x040;
+BOOST_CONSTEXPR_OR_CONST unsigned tcp_cwr = 0x080;
+
+// TCP header (RFC 9293), without options
+
+struct tcp_header
+{
+    big_uint16_buf_t source_port;
+    big_uint16_buf_t destination_port;
+    big_uint32_buf_t sequence_number;
+    big_uint32_buf_t acknowledgment_number;
+    big_uint16_buf_t offset_flags;
+    big_uint16_buf_t window;
+    big_uint16_buf_t checksum;
+    big_uint16_buf_t urgent_pointer;
+
+    // header length in bytes, including options
+
+    std::size_t header_length() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( offset_flags.value() >> 12 ) * 4;
+    }
+
+    unsigned flags() const BOOST_NOEXCEPT
+    {
+        return offset_flags.value() & 0x01FF;
+    }
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(tcp_header) == 20 );
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_TCP_HPP_INCLUDED
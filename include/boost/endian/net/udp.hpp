@@ -0,0 +1,36 @@
+#ifndef BOOST_ENDIAN_NET_UDP_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_UDP_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/header_cast.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+
+namespace boost
+{
+namespace endian
+{
+namespace net
+{
+
+// UDP header (RFC 768)
+
+struct udp_header
+{
+    big_uint16_buf_t source_port;
+    big_uint16_buf_t destination_port;
+    big_uint16_buf_t length;
+    big_uint16_buf_t checksum;
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(udp_header) == 8 );
+
+} // namespace net
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_UDP_HPP_INCLUDED
@@ -0,0 +1,313 @@
+#ifndef BOOST_ENDIAN_OFFSET_PTR_HPP_INCLUDED
+#define BOOST_ENDIAN_OFFSET_PTR_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  Pointers stored as offsets in a fixed byte order, so that structures
+//  containing them can be written to a file, mapped at any address on any
+//  host, and traversed without deserialization. The offsets are stored in
+//  endian_buffer objects, so the pointer types have no alignment requirement.
+
+namespace boost
+{
+namespace endian
+{
+
+  //  a pointer to T, stored as the signed distance in bytes from the
+  //  pointer object itself to the target; 0 is the null pointer
+  template<class T, order Order = order::little, class OffsetT = std::int32_t>
+    class endian_offset_ptr;
+
+  //  a pointer to T, stored as the distance in bytes from a base address
+  //  supplied on each access; 0 is the null pointer
+  template<class T, order Order = order::little, class OffsetT = std::uint32_t>
+    class endian_base_offset;
+
+  template<class T, class OffsetT = std::int32_t>
+    using big_offset_ptr = endian_offset_ptr<T, order::big, OffsetT>;
+  template<class T, class OffsetT = std::int32_t>
+    using little_offset_ptr = endian_offset_ptr<T, order::little, OffsetT>;
+
+  template<class T, class OffsetT = std::uint32_t>
+    using big_base_offset = endian_base_offset<T, order::big, OffsetT>;
+  template<class T, class OffsetT = std::uint32_t>
+    using little_base_offset = endian_base_offset<T, order::little, OffsetT>;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+inline std::uintptr_t offset_ptr_address( void const * p ) BOOST_NOEXCEPT
+{
+    return reinterpret_cast<std::uintptr_t>( p );
+}
+
+// the distance from a to b, computed on integers so that a and b need not
+// point into the same object
+
+inline std::intptr_t offset_ptr_distance( void const * a, void const * b ) BOOST_NOEXCEPT
+{
+    return static_cast<std::intptr_t>( offset_ptr_address( b ) - offset_ptr_address( a ) );
+}
+
+template<class T> inline T * offset_ptr_advance( void const * a, std::intptr_t d ) BOOST_NOEXCEPT
+{
+    return reinterpret_cast<T*>( offset_ptr_address( a ) + static_cast<std::uintptr_t>( d ) );
+}
+
+template<class OffsetT> inline bool offset_ptr_fits( std::intptr_t d ) BOOST_NOEXCEPT
+{
+    return d >= 0?
+        static_cast<std::uintmax_t>( d ) <= static_cast<std::uintmax_t>( std::numeric_limits<OffsetT>::max() ):
+        std::is_signed<OffsetT>::value && static_cast<std::intmax_t>( d ) >= static_cast<std::intmax_t>( std::numeric_limits<OffsetT>::min() );
+}
+
+} // namespace detail
+
+//  endian_offset_ptr  -----------------------------------------------------------------//
+
+//  Copying an endian_offset_ptr recomputes the offset for the new location,
+//  so the copy points to the same object; copying its bytes does not.
+
+template<class T, order Order, class OffsetT> class endian_offset_ptr
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<OffsetT>::value && std::is_signed<OffsetT>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof(OffsetT) == 1 || sizeof(OffsetT) == 2 || sizeof(OffsetT) == 4 || sizeof(OffsetT) == 8 );
+
+    endian_buffer<Order, OffsetT, sizeof(OffsetT) * 8> offset_;
+
+private:
+
+    void set( T const * p ) BOOST_NOEXCEPT
+    {
+        offset_ = p == 0? static_cast<OffsetT>( 0 ): static_cast<OffsetT>( detail::offset_ptr_distance( this, p ) );
+    }
+
+public:
+
+    typedef T element_type;
+    typedef OffsetT offset_type;
+
+    endian_offset_ptr() BOOST_NOEXCEPT
+    {
+        offset_ = 0;
+    }
+
+    endian_offset_ptr( std::nullptr_t ) BOOST_NOEXCEPT
+    {
+        offset_ = 0;
+    }
+
+    //  Requires: can_point_to( p )
+
+    endian_offset_ptr( T * p ) BOOST_NOEXCEPT
+    {
+        set( p );
+    }
+
+    endian_offset_ptr( endian_offset_ptr const & r ) BOOST_NOEXCEPT
+    {
+        set( r.get() );
+    }
+
+    endian_offset_ptr& operator=( endian_offset_ptr const & r ) BOOST_NOEXCEPT
+    {
+        set( r.get() );
+        return *this;
+    }
+
+    endian_offset_ptr& operator=( T * p ) BOOST_NOEXCEPT
+    {
+        set( p );
+        return *this;
+    }
+
+    endian_offset_ptr& operator=( std::nullptr_t ) BOOST_NOEXCEPT
+    {
+        offset_ = 0;
+        return *this;
+    }
+
+    T * get() const BOOST_NOEXCEPT
+    {
+        OffsetT d = offset_.value();
+        return d == 0? 0: detail::offset_ptr_advance<T>( this, static_cast<std::intptr_t>( d ) );
+    }
+
+    T & operator*() const BOOST_NOEXCEPT
+    {
+        return *get();
+    }
+
+    T * operator->() const BOOST_NOEXCEPT
+    {
+        return get();
+    }
+
+    T & operator[]( std::ptrdiff_t i ) const BOOST_NOEXCEPT
+    {
+        return get()[ i ];
+    }
+
+    explicit operator bool() const BOOST_NOEXCEPT
+    {
+        return offset_.value() != 0;
+    }
+
+    //  Returns: the stored offset
+
+    OffsetT offset() const BOOST_NOEXCEPT
+    {
+        return offset_.value();
+    }
+
+    //  Returns: whether p can be stored in this object; p == this cannot,
+    //           as its offset is the null pointer
+
+    bool can_point_to( T const * p ) const BOOST_NOEXCEPT
+    {
+        if( p == 0 ) return true;
+
+        std::intptr_t d = detail::offset_ptr_distance( this, p );
+        return d != 0 && detail::offset_ptr_fits<OffsetT>( d );
+    }
+
+    friend bool operator==( endian_offset_ptr const & a, endian_offset_ptr const & b ) BOOST_NOEXCEPT
+    {
+        return a.get() == b.get();
+    }
+
+    friend bool operator!=( endian_offset_ptr const & a, endian_offset_ptr const & b ) BOOST_NOEXCEPT
+    {
+        return a.get() != b.get();
+    }
+
+    friend bool operator==( endian_offset_ptr const & a, T const * b ) BOOST_NOEXCEPT
+    {
+        return a.get() == b;
+    }
+
+    friend bool operator!=( endian_offset_ptr const & a, T const * b ) BOOST_NOEXCEPT
+    {
+        return a.get() != b;
+    }
+
+    friend bool operator==( endian_offset_ptr const & a, std::nullptr_t ) BOOST_NOEXCEPT
+    {
+        return !a;
+    }
+
+    friend bool operator!=( endian_offset_ptr const & a, std::nullptr_t ) BOOST_NOEXCEPT
+    {
+        return !!a;
+    }
+};
+
+//  endian_base_offset  ----------------------------------------------------------------//
+
+//  Trivially copyable; the offsets remain valid when the bytes are copied
+//  along with the base, for instance when the whole file is.
+
+template<class T, order Order, class OffsetT> class endian_base_offset
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<OffsetT>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof(OffsetT) == 1 || sizeof(OffsetT) == 2 || sizeof(OffsetT) == 4 || sizeof(OffsetT) == 8 );
+
+    endian_buffer<Order, OffsetT, sizeof(OffsetT) * 8> offset_;
+
+public:
+
+    typedef T element_type;
+    typedef OffsetT offset_type;
+
+    endian_base_offset() = default;
+
+    explicit endian_base_offset( OffsetT offset ) BOOST_NOEXCEPT
+    {
+        offset_ = offset;
+    }
+
+    //  Returns: the object at offset() bytes from base, or a null pointer
+    //           when offset() is 0
+
+    T * get( void const * base ) const BOOST_NOEXCEPT
+    {
+        OffsetT d = offset_.value();
+        return d == 0? 0: detail::offset_ptr_advance<T>( base, static_cast<std::intptr_t>( d ) );
+    }
+
+    //  Requires: can_point_to( base, p )
+
+    void set( void const * base, T const * p ) BOOST_NOEXCEPT
+    {
+        offset_ = p == 0? static_cast<OffsetT>( 0 ): static_cast<OffsetT>( detail::offset_ptr_distance( base, p ) );
+    }
+
+    void reset() BOOST_NOEXCEPT
+    {
+        offset_ = 0;
+    }
+
+    explicit operator bool() const BOOST_NOEXCEPT
+    {
+        return offset_.value() != 0;
+    }
+
+    OffsetT offset() const BOOST_NOEXCEPT
+    {
+        return offset_.value();
+    }
+
+    //  Returns: whether set( base, p ) can store p; p == base cannot,
+    //           as its offset is the null pointer
+
+    static bool can_point_to( void const * base, T const * p ) BOOST_NOEXCEPT
+    {
+        if( p == 0 ) return true;
+
+        std::intptr_t d = detail::offset_ptr_distance( base, p );
+        return d != 0 && detail::offset_ptr_fits<OffsetT>( d );
+    }
+
+    friend bool operator==( endian_base_offset const & a, endian_base_offset const & b ) BOOST_NOEXCEPT
+    {
+        return a.offset() == b.offset();
+    }
+
+    friend bool operator!=( endian_base_offset const & a, endian_base_offset const & b ) BOOST_NOEXCEPT
+    {
+        return a.offset() != b.offset();
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_OFFSET_PTR_HPP_INCLUDED
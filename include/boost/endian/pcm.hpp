@@ -0,0 +1,278 @@
+#ifndef BOOST_ENDIAN_PCM_HPP_INCLUDED
+#define BOOST_ENDIAN_PCM_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_bulk.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/detail/usdt.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  Linear PCM samples of N bytes (N is 2, 3 or 4) in byte order Order,
+  //  mapped to float in [-1, 1): a sample s corresponds to s / 2^(8*N-1)
+
+  //  Effects: out[i] = sample i / 2^(8*N-1), i < n
+  template<order Order, std::size_t N>
+    void pcm_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+
+  //  Effects: stores first[i] * 2^(8*N-1) as sample i, i < n, rounded to
+  //           nearest with ties away from zero and clipped to the sample range;
+  //           NaN is stored as zero
+  template<order Order, std::size_t N>
+    void float_to_pcm_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+
+  //  AIFF, broadcast and network formats
+  inline void big_s16_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+  inline void big_s24_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+  inline void big_s32_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+
+  inline void float_to_big_s16_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+  inline void float_to_big_s24_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+  inline void float_to_big_s32_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+
+  //  WAV formats
+  inline void little_s16_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+  inline void little_s24_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+  inline void little_s32_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT;
+
+  inline void float_to_little_s16_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+  inline void float_to_little_s24_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+  inline void float_to_little_s32_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// Loading 32-bit samples needs double, since float cannot represent every
+// 32-bit sample exactly
+
+template<std::size_t N> struct pcm_traits
+{
+    BOOST_ENDIAN_STATIC_ASSERT( N == 2 || N == 3 || N == 4 );
+
+    typedef typename std::conditional<N == 4, double, float>::type compute_type;
+
+    static BOOST_CONSTEXPR compute_type scale() BOOST_NOEXCEPT
+    {
+        return static_cast<compute_type>( static_cast<std::uint32_t>( 1 ) << ( 8 * N - 1 ) );
+    }
+
+    static BOOST_CONSTEXPR compute_type lowest() BOOST_NOEXCEPT
+    {
+        return -scale();
+    }
+
+    static BOOST_CONSTEXPR compute_type highest() BOOST_NOEXCEPT
+    {
+        return scale() - 1;
+    }
+};
+
+// 16 and 32 bit samples are loaded at their own width, with the element
+// helpers of the bulk functions, so that a call is counted once, as a whole.
+// 24 bit samples are assembled from their bytes and sign-extended with
+// integer arithmetic, which, unlike the byte-wise expanding load, vectorizes
+
+template<order Order, std::size_t N> struct pcm_sample;
+
+template<order Order> struct pcm_sample<Order, 2>
+{
+    static std::int32_t load( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        return static_cast<std::int16_t>( detail::endian_bulk_load<std::uint16_t, Order>( p ) );
+    }
+
+    static void store( unsigned char * p, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        detail::endian_bulk_store<std::uint16_t, Order>( p, static_cast<std::uint16_t>( v ) );
+    }
+};
+
+template<> struct pcm_sample<order::big, 3>
+{
+    static std::int32_t load( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        std::uint32_t v = static_cast<std::uint32_t>( p[0] ) << 16 | static_cast<std::uint32_t>( p[1] ) << 8 | p[2];
+        return static_cast<std::int32_t>( v ^ 0x800000u ) - 0x800000;
+    }
+
+    static void store( unsigned char * p, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        p[0] = static_cast<unsigned char>( v >> 16 );
+        p[1] = static_cast<unsigned char>( v >> 8 );
+        p[2] = static_cast<unsigned char>( v );
+    }
+};
+
+template<> struct pcm_sample<order::little, 3>
+{
+    static std::int32_t load( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        std::uint32_t v = static_cast<std::uint32_t>( p[2] ) << 16 | static_cast<std::uint32_t>( p[1] ) << 8 | p[0];
+        return static_cast<std::int32_t>( v ^ 0x800000u ) - 0x800000;
+    }
+
+    static void store( unsigned char * p, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        p[0] = static_cast<unsigned char>( v );
+        p[1] = static_cast<unsigned char>( v >> 8 );
+        p[2] = static_cast<unsigned char>( v >> 16 );
+    }
+};
+
+template<order Order> struct pcm_sample<Order, 4>
+{
+    static std::int32_t load( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        return static_cast<std::int32_t>( detail::endian_bulk_load<std::uint32_t, Order>( p ) );
+    }
+
+    static void store( unsigned char * p, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        detail::endian_bulk_store<std::uint32_t, Order>( p, static_cast<std::uint32_t>( v ) );
+    }
+};
+
+} // namespace detail
+
+template<order Order, std::size_t N>
+inline void pcm_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( N ), n * N );
+    BOOST_ENDIAN_USDT_BATCH( usdt_pcm_to_float_n, N, n );
+
+    typedef detail::pcm_traits<N> traits;
+    typedef typename traits::compute_type C;
+
+    C const k = 1 / traits::scale();
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::int32_t s = detail::pcm_sample<Order, N>::load( p + i * N );
+        out[ i ] = static_cast<float>( static_cast<C>( s ) * k );
+    }
+}
+
+template<order Order, std::size_t N>
+inline void float_to_pcm_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( N ), n * N );
+    BOOST_ENDIAN_USDT_BATCH( usdt_float_to_pcm_n, N, n );
+
+    typedef detail::pcm_traits<N> traits;
+
+    // the scaling and the rounding are done in double for all N; there,
+    // adding 0.5 to a scaled float is exact, while in float a value just
+    // below 0.5 would round up to 1
+
+    double const k = static_cast<double>( traits::scale() );
+    double const lo = static_cast<double>( traits::lowest() );
+    double const hi = static_cast<double>( traits::highest() );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        float f = first[ i ];
+
+        double x = static_cast<double>( f ) * k;
+
+        // written as selects and masks, so that the loop vectorizes;
+        // the comparisons map NaN to lo, the mask then to zero
+
+        x += x < 0? -0.5: 0.5;
+        x = x >= lo? x: lo;
+        x = x <= hi? x: hi;
+
+        std::int32_t v = static_cast<std::int32_t>( x ) & -static_cast<std::int32_t>( f == f );
+
+        detail::pcm_sample<Order, N>::store( p + i * N, v );
+    }
+}
+
+inline void big_s16_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::big, 2>( p, n, out );
+}
+
+inline void big_s24_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::big, 3>( p, n, out );
+}
+
+inline void big_s32_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::big, 4>( p, n, out );
+}
+
+inline void float_to_big_s16_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::big, 2>( first, n, p );
+}
+
+inline void float_to_big_s24_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::big, 3>( first, n, p );
+}
+
+inline void float_to_big_s32_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::big, 4>( first, n, p );
+}
+
+inline void little_s16_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::little, 2>( p, n, out );
+}
+
+inline void little_s24_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::little, 3>( p, n, out );
+}
+
+inline void little_s32_to_float_n( unsigned char const * p, std::size_t n, float * out ) BOOST_NOEXCEPT
+{
+    boost::endian::pcm_to_float_n<order::little, 4>( p, n, out );
+}
+
+inline void float_to_little_s16_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::little, 2>( first, n, p );
+}
+
+inline void float_to_little_s24_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::little, 3>( first, n, p );
+}
+
+inline void float_to_little_s32_n( float const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    boost::endian::float_to_pcm_n<order::little, 4>( first, n, p );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_PCM_HPP_INCLUDED
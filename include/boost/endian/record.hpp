@@ -0,0 +1,248 @@
+#ifndef BOOST_ENDIAN_RECORD_HPP_INCLUDED
+#define BOOST_ENDIAN_RECORD_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/detail/usdt.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  A record of consecutive fields of the given sizes, in bytes, each of
+  //  which is stored in the same byte order; fields of size 1 are bytes
+  template<std::size_t... Sizes>
+    struct record_layout;
+
+  //  The layout of a record whose fields have the types Fields..., for
+  //  instance endian_buffer types
+  template<class... Fields>
+    using record_layout_of = record_layout<sizeof(Fields)...>;
+
+  //  Effects: reverses the bytes of every field of the n records at p
+  template<class Layout>
+    void endian_reverse_records_n( unsigned char * p, std::size_t n ) BOOST_NOEXCEPT;
+
+  //  Requires: dst == src, or [dst, dst + n * Layout::size) and
+  //            [src, src + n * Layout::size) do not overlap
+  //
+  //  Effects: stores in dst the n records at src, with every field converted
+  //           from byte order From to byte order To
+  template<class Layout, order From, order To>
+    void endian_convert_records_n( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT;
+
+  //  As above, with the byte orders given at run time
+  template<class Layout>
+    void endian_convert_records_n( unsigned char * dst, unsigned char const * src, std::size_t n,
+      order from_order, order to_order ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+template<std::size_t... I> struct record_index_list
+{
+};
+
+template<std::size_t N, std::size_t... I> struct make_record_index_list: make_record_index_list<N - 1, N - 1, I...>
+{
+};
+
+template<std::size_t... I> struct make_record_index_list<0, I...>
+{
+    typedef record_index_list<I...> type;
+};
+
+template<std::size_t... Sizes> struct record_layout_impl;
+
+template<> struct record_layout_impl<>
+{
+    static BOOST_CONSTEXPR std::size_t size() BOOST_NOEXCEPT
+    {
+        return 0;
+    }
+
+    static BOOST_CONSTEXPR bool no_empty_fields() BOOST_NOEXCEPT
+    {
+        return true;
+    }
+
+    static BOOST_CONSTEXPR std::size_t source_index( std::size_t i, std::size_t ) BOOST_NOEXCEPT
+    {
+        return i;
+    }
+};
+
+template<std::size_t S1, std::size_t... Sizes> struct record_layout_impl<S1, Sizes...>
+{
+    static BOOST_CONSTEXPR std::size_t size() BOOST_NOEXCEPT
+    {
+        return S1 + record_layout_impl<Sizes...>::size();
+    }
+
+    static BOOST_CONSTEXPR bool no_empty_fields() BOOST_NOEXCEPT
+    {
+        return S1 > 0 && record_layout_impl<Sizes...>::no_empty_fields();
+    }
+
+    // byte i, in a field that starts at offset, comes from the mirrored
+    // position in the same field
+
+    static BOOST_CONSTEXPR std::size_t source_index( std::size_t i, std::size_t offset ) BOOST_NOEXCEPT
+    {
+        return i < offset + S1? 2 * offset + S1 - 1 - i: record_layout_impl<Sizes...>::source_index( i, offset + S1 );
+    }
+};
+
+template<class Layout, class L> struct record_permutation_table;
+
+template<class Layout, std::size_t... I> struct record_permutation_table<Layout, record_index_list<I...> >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char value[ sizeof...(I) ] = { static_cast<unsigned char>( Layout::source_index( I ) )... };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class Layout, std::size_t... I>
+BOOST_CONSTEXPR_OR_CONST unsigned char record_permutation_table<Layout, record_index_list<I...> >::value[ sizeof...(I) ];
+
+#endif
+
+} // namespace detail
+
+template<std::size_t... Sizes> struct record_layout
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof...(Sizes) > 0 );
+    BOOST_ENDIAN_STATIC_ASSERT( detail::record_layout_impl<Sizes...>::no_empty_fields() );
+
+    static BOOST_CONSTEXPR_OR_CONST std::size_t size = detail::record_layout_impl<Sizes...>::size();
+    static BOOST_CONSTEXPR_OR_CONST std::size_t field_count = sizeof...(Sizes);
+
+    BOOST_ENDIAN_STATIC_ASSERT( size <= 256 );
+
+    // Returns: the index of the byte that moves to position i when every
+    //          field is reversed
+
+    static BOOST_CONSTEXPR std::size_t source_index( std::size_t i ) BOOST_NOEXCEPT
+    {
+        return detail::record_layout_impl<Sizes...>::source_index( i, 0 );
+    }
+
+    // permutation()[i] == source_index(i), i < size
+
+    static unsigned char const * permutation() BOOST_NOEXCEPT
+    {
+        return detail::record_permutation_table<record_layout, typename detail::make_record_index_list<size>::type>::value;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<std::size_t... Sizes>
+BOOST_CONSTEXPR_OR_CONST std::size_t record_layout<Sizes...>::size;
+
+template<std::size_t... Sizes>
+BOOST_CONSTEXPR_OR_CONST std::size_t record_layout<Sizes...>::field_count;
+
+#endif
+
+namespace detail
+{
+
+// Every record undergoes the same byte permutation, taken from a constant
+// table, so that the compiler can turn the inner loop into byte shuffles
+
+template<class Layout> inline void endian_reverse_records_impl( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t const N = Layout::size;
+    unsigned char const * perm = detail::record_permutation_table<Layout, typename make_record_index_list<N>::type>::value;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char tmp[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            tmp[ j ] = src[ i * N + perm[ j ] ];
+        }
+
+        std::memcpy( dst + i * N, tmp, N );
+    }
+}
+
+template<class Layout> inline void endian_convert_records( unsigned char * dst, unsigned char const * src, std::size_t n, std::true_type ) BOOST_NOEXCEPT
+{
+    if( n != 0 && dst != src )
+    {
+        std::memcpy( dst, src, n * Layout::size );
+    }
+}
+
+template<class Layout> inline void endian_convert_records( unsigned char * dst, unsigned char const * src, std::size_t n, std::false_type ) BOOST_NOEXCEPT
+{
+    detail::endian_reverse_records_impl<Layout>( dst, src, n );
+}
+
+} // namespace detail
+
+template<class Layout>
+inline void endian_reverse_records_n( unsigned char * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( Layout::size ), n * Layout::size );
+    BOOST_ENDIAN_USDT_BATCH( usdt_reverse_records_n, Layout::size, n );
+
+    detail::endian_reverse_records_impl<Layout>( p, p, n );
+}
+
+template<class Layout, order From, order To>
+inline void endian_convert_records_n( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( Layout::size ), n * Layout::size );
+    BOOST_ENDIAN_USDT_BATCH( usdt_convert_records_n, Layout::size, n );
+
+    detail::endian_convert_records<Layout>( dst, src, n, std::integral_constant<bool, From == To>() );
+}
+
+template<class Layout>
+inline void endian_convert_records_n( unsigned char * dst, unsigned char const * src, std::size_t n,
+    order from_order, order to_order ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( Layout::size ), n * Layout::size );
+    BOOST_ENDIAN_USDT_BATCH( usdt_convert_records_n, Layout::size, n );
+
+    if( from_order == to_order )
+    {
+        detail::endian_convert_records<Layout>( dst, src, n, std::true_type() );
+    }
+    else
+    {
+        detail::endian_convert_records<Layout>( dst, src, n, std::false_type() );
+    }
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_RECORD_HPP_INCLUDED
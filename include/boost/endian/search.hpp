@@ -0,0 +1,289 @@
+#ifndef BOOST_ENDIAN_SEARCH_HPP_INCLUDED
+#define BOOST_ENDIAN_SEARCH_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/integral_by_size.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  Algorithms over arrays of endian_buffer or endian_arithmetic objects E
+  //  with an integral value type and a size of 1, 2, 4 or 8 bytes. The
+  //  search value v is of type E::value_type.
+
+  //  Returns: a pointer to the first element equal to v, or last
+  template<class E>
+    E const * endian_find( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT;
+
+  //  Returns: the number of elements equal to v
+  template<class E>
+    std::size_t endian_count( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT;
+
+  //  Requires: [first, last) is sorted by value
+  //
+  //  Returns: a pointer to the first element not less than v, or last
+  template<class E>
+    E const * endian_lower_bound( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT;
+
+  //  A decoded sample of every stride-th value of a sorted array, for
+  //  searches that do not decode elements outside of the final block
+  template<class E>
+    class endian_sampled_index;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+template<class E> struct endian_search_traits
+{
+};
+
+template<order Order, class T, std::size_t n_bits, align A> struct endian_search_traits< endian_buffer<Order, T, n_bits, A> >
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( n_bits == 8 || n_bits == 16 || n_bits == 32 || n_bits == 64 );
+
+    // the elements are loaded and compared at the width of T
+    BOOST_ENDIAN_STATIC_ASSERT( n_bits == sizeof(T) * 8 );
+
+    typedef typename integral_by_size<n_bits / 8>::type U;
+
+    static BOOST_CONSTEXPR_OR_CONST order byte_order = Order;
+};
+
+template<order Order, class T, std::size_t n_bits, align A> struct endian_search_traits< endian_arithmetic<Order, T, n_bits, A> >:
+    endian_search_traits< endian_buffer<Order, T, n_bits, A> >
+{
+};
+
+template<class E> inline typename endian_search_traits<E>::U endian_search_raw( E const * p ) BOOST_NOEXCEPT
+{
+    typename endian_search_traits<E>::U x;
+    std::memcpy( &x, p->data(), sizeof(x) );
+
+    return x;
+}
+
+// the search value, stored like the elements
+
+template<class E> inline typename endian_search_traits<E>::U endian_search_needle( typename E::value_type v ) BOOST_NOEXCEPT
+{
+    typedef endian_search_traits<E> traits;
+    typedef typename traits::U U;
+
+    unsigned char tmp[ sizeof(U) ];
+    boost::endian::endian_store<typename E::value_type, sizeof(U), traits::byte_order>( tmp, v );
+
+    U x;
+    std::memcpy( &x, tmp, sizeof(U) );
+
+    return x;
+}
+
+// Returns: the number of elements of [first, first + n) less than v; when
+// the range is sorted, this is the offset of the lower bound. There are no
+// branches on the data, so the loop vectorizes.
+
+template<class E> inline std::size_t endian_count_less( E const * first, std::size_t n, typename E::value_type v ) BOOST_NOEXCEPT
+{
+    typedef typename E::value_type T;
+
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T x = boost::endian::endian_load<T, sizeof(T), endian_search_traits<E>::byte_order>( first[ i ].data() );
+        r += x < v;
+    }
+
+    return r;
+}
+
+// blocks at which the ordered searches switch to the linear count, and
+// the equality search checks for a match
+
+BOOST_CONSTEXPR_OR_CONST std::size_t endian_search_block = 32;
+
+} // namespace detail
+
+// Equality is tested on the stored representation; the search value is
+// converted once, and the elements are not decoded
+
+template<class E>
+inline E const * endian_find( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT
+{
+    typedef typename detail::endian_search_traits<E>::U U;
+
+    U const needle = detail::endian_search_needle<E>( v );
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+    std::size_t const B = detail::endian_search_block;
+
+    std::size_t i = 0;
+
+    for( ; i + B <= n; i += B )
+    {
+        // no early exit within a block, so that it vectorizes
+
+        std::size_t m = 0;
+
+        for( std::size_t j = 0; j < B; ++j )
+        {
+            m += detail::endian_search_raw( first + i + j ) == needle;
+        }
+
+        if( m != 0 ) break;
+    }
+
+    for( ; i < n; ++i )
+    {
+        if( detail::endian_search_raw( first + i ) == needle ) return first + i;
+    }
+
+    return last;
+}
+
+template<class E>
+inline std::size_t endian_count( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT
+{
+    typedef typename detail::endian_search_traits<E>::U U;
+
+    U const needle = detail::endian_search_needle<E>( v );
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += detail::endian_search_raw( first + i ) == needle;
+    }
+
+    return r;
+}
+
+// Binary search down to a block, then a linear count over the block
+
+template<class E>
+inline E const * endian_lower_bound( E const * first, E const * last, typename E::value_type v ) BOOST_NOEXCEPT
+{
+    std::size_t n = static_cast<std::size_t>( last - first );
+
+    while( n > detail::endian_search_block )
+    {
+        std::size_t h = n / 2;
+
+        if( first[ h ].value() < v )
+        {
+            first += h + 1;
+            n -= h + 1;
+        }
+        else
+        {
+            n = h;
+        }
+    }
+
+    return first + detail::endian_count_less( first, n, v );
+}
+
+template<class E> class endian_sampled_index
+{
+private:
+
+    typedef typename E::value_type T;
+
+    E const * first_;
+    E const * last_;
+    std::size_t stride_;
+
+    // samples_[ i ] == first_[ i * stride_ ].value()
+    std::vector<T> samples_;
+
+public:
+
+    // Requires: [first, last) is sorted by value and outlives the index;
+    //           stride > 0
+
+    endian_sampled_index( E const * first, E const * last, std::size_t stride = 64 ):
+        first_( first ), last_( last ), stride_( stride )
+    {
+        std::size_t n = static_cast<std::size_t>( last - first );
+
+        samples_.reserve( ( n + stride - 1 ) / stride );
+
+        for( std::size_t i = 0; i < n; i += stride )
+        {
+            samples_.push_back( first[ i ].value() );
+        }
+    }
+
+    std::size_t stride() const BOOST_NOEXCEPT
+    {
+        return stride_;
+    }
+
+    std::size_t sample_count() const BOOST_NOEXCEPT
+    {
+        return samples_.size();
+    }
+
+    // Returns: endian_lower_bound( first, last, v )
+
+    E const * lower_bound( T v ) const BOOST_NOEXCEPT
+    {
+        // the first sample not less than v; the lower bound is in the
+        // block that ends there
+
+        std::size_t k = static_cast<std::size_t>( std::lower_bound( samples_.begin(), samples_.end(), v ) - samples_.begin() );
+
+        if( k == 0 ) return first_;
+
+        E const * p = first_ + ( k - 1 ) * stride_;
+        std::size_t n = std::min<std::size_t>( stride_, static_cast<std::size_t>( last_ - p ) );
+
+        return p + detail::endian_count_less( p, n, v );
+    }
+
+    // Returns: a pointer to an element equal to v, or last
+
+    E const * find( T v ) const BOOST_NOEXCEPT
+    {
+        E const * p = lower_bound( v );
+        return p != last_ && p->value() == v? p: last_;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_SEARCH_HPP_INCLUDED
@@ -0,0 +1,113 @@
+#ifndef BOOST_ENDIAN_SHUFFLE_HPP_INCLUDED
+#define BOOST_ENDIAN_SHUFFLE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/conversion_counters.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/detail/usdt.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  The byte planes of n elements of N bytes are N consecutive arrays of
+  //  n bytes; plane k holds byte k, in order of increasing significance,
+  //  of every element. This is the layout produced by the Blosc shuffle
+  //  filter on little-endian machines, regardless of the source byte order.
+
+  //  Requires: N is 2, 4 or 8; [src, src + n * N) and [dst, dst + n * N)
+  //            do not overlap
+  //
+  //  Effects: stores in dst the byte planes of the n elements of N bytes
+  //           in byte order Order at src
+  template<std::size_t N, order Order>
+    void byte_shuffle_n( unsigned char const * src, std::size_t n, unsigned char * dst ) BOOST_NOEXCEPT;
+
+  //  Requires: N is 2, 4 or 8; [src, src + n * N) and [dst, dst + n * N)
+  //            do not overlap
+  //
+  //  Effects: stores in dst, in byte order Order, the n elements of N bytes
+  //           whose byte planes are at src
+  template<std::size_t N, order Order>
+    void byte_unshuffle_n( unsigned char const * src, std::size_t n, unsigned char * dst ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// offset, within an element of N bytes in byte order Order, of the byte
+// of significance k
+
+template<std::size_t N, order Order> struct byte_plane_offset
+{
+    BOOST_ENDIAN_STATIC_ASSERT( N == 2 || N == 4 || N == 8 );
+
+    static BOOST_CONSTEXPR std::size_t value( std::size_t k ) BOOST_NOEXCEPT
+    {
+        return Order == order::little? k: N - 1 - k;
+    }
+};
+
+} // namespace detail
+
+// The inner loop over the N planes is unrolled by the compiler, and the
+// outer loop vectorized into byte shuffles, so that the byte order
+// normalization costs nothing over a plain transpose
+
+template<std::size_t N, order Order>
+inline void byte_shuffle_n( unsigned char const * src, std::size_t n, unsigned char * dst ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( N ), n * N );
+    BOOST_ENDIAN_USDT_BATCH( usdt_byte_shuffle_n, N, n );
+
+    typedef detail::byte_plane_offset<N, Order> offset;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        for( std::size_t k = 0; k < N; ++k )
+        {
+            dst[ k * n + i ] = src[ i * N + offset::value( k ) ];
+        }
+    }
+}
+
+template<std::size_t N, order Order>
+inline void byte_unshuffle_n( unsigned char const * src, std::size_t n, unsigned char * dst ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_COUNT_CONVERSION( detail::conversion_bulk_index( N ), n * N );
+    BOOST_ENDIAN_USDT_BATCH( usdt_byte_unshuffle_n, N, n );
+
+    typedef detail::byte_plane_offset<N, Order> offset;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        for( std::size_t k = 0; k < N; ++k )
+        {
+            dst[ i * N + offset::value( k ) ] = src[ k * n + i ];
+        }
+    }
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_SHUFFLE_HPP_INCLUDED
@@ -0,0 +1,167 @@
+#ifndef BOOST_ENDIAN_SORTABLE_HPP_INCLUDED
+#define BOOST_ENDIAN_SORTABLE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/integral_by_size.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  Sortable keys are sizeof(T)-byte big-endian encodings of T whose
+  //  lexicographic (memcmp) order is the numeric order of T. T is an integral
+  //  type other than bool, float, or double.
+
+  template<class T>
+    void store_sortable_key( unsigned char * p, T v ) BOOST_NOEXCEPT;
+  template<class T>
+    T load_sortable_key( unsigned char const * p ) BOOST_NOEXCEPT;
+
+  //  Effects: store_sortable_key( p + i * sizeof(T), first[i] ), i < n
+  template<class T>
+    void store_sortable_keys_n( T const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT;
+
+  //  Effects: out[i] = load_sortable_key<T>( p + i * sizeof(T) ), i < n
+  template<class T>
+    void load_sortable_keys_n( unsigned char const * p, std::size_t n, T * out ) BOOST_NOEXCEPT;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+template<class T, class E = void> struct sortable_key_traits
+{
+};
+
+// unsigned integers are already ordered
+
+template<class T> struct sortable_key_traits<T, typename std::enable_if< std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value >::type>
+{
+    typedef typename integral_by_size<sizeof(T)>::type U;
+
+    static U encode( U x ) BOOST_NOEXCEPT
+    {
+        return x;
+    }
+
+    static U decode( U x ) BOOST_NOEXCEPT
+    {
+        return x;
+    }
+};
+
+// signed integers: flip the sign bit
+
+template<class T> struct sortable_key_traits<T, typename std::enable_if< std::is_integral<T>::value && std::is_signed<T>::value >::type>
+{
+    typedef typename integral_by_size<sizeof(T)>::type U;
+
+    static U encode( U x ) BOOST_NOEXCEPT
+    {
+        return static_cast<U>( x ^ ( U( 1 ) << ( sizeof(U) * 8 - 1 ) ) );
+    }
+
+    static U decode( U x ) BOOST_NOEXCEPT
+    {
+        return encode( x );
+    }
+};
+
+// IEEE floating point: flip all bits of negative values, only the sign bit of
+// positive ones; written without branches, so that bulk loops vectorize
+
+template<class T> struct sortable_key_traits<T, typename std::enable_if< std::is_floating_point<T>::value >::type>
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::numeric_limits<T>::is_iec559 && ( sizeof(T) == 4 || sizeof(T) == 8 ) );
+
+    typedef typename integral_by_size<sizeof(T)>::type U;
+
+    static U encode( U x ) BOOST_NOEXCEPT
+    {
+        U const sign = U( 1 ) << ( sizeof(U) * 8 - 1 );
+        return x ^ ( static_cast<U>( U( 0 ) - ( x >> ( sizeof(U) * 8 - 1 ) ) ) | sign );
+    }
+
+    static U decode( U x ) BOOST_NOEXCEPT
+    {
+        U const sign = U( 1 ) << ( sizeof(U) * 8 - 1 );
+        return x ^ ( static_cast<U>( ( x >> ( sizeof(U) * 8 - 1 ) ) - 1 ) | sign );
+    }
+};
+
+} // namespace detail
+
+template<class T>
+inline void store_sortable_key( unsigned char * p, T v ) BOOST_NOEXCEPT
+{
+    typedef detail::sortable_key_traits<T> traits;
+    typedef typename traits::U U;
+
+    U x;
+    std::memcpy( &x, &v, sizeof(T) );
+
+    boost::endian::endian_store<U, sizeof(U), order::big>( p, traits::encode( x ) );
+}
+
+template<class T>
+inline T load_sortable_key( unsigned char const * p ) BOOST_NOEXCEPT
+{
+    typedef detail::sortable_key_traits<T> traits;
+    typedef typename traits::U U;
+
+    U x = traits::decode( boost::endian::endian_load<U, sizeof(U), order::big>( p ) );
+
+    T v;
+    std::memcpy( &v, &x, sizeof(T) );
+
+    return v;
+}
+
+template<class T>
+inline void store_sortable_keys_n( T const * first, std::size_t n, unsigned char * p ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        boost::endian::store_sortable_key( p + i * sizeof(T), first[ i ] );
+    }
+}
+
+template<class T>
+inline void load_sortable_keys_n( unsigned char const * p, std::size_t n, T * out ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        out[ i ] = boost::endian::load_sortable_key<T>( p + i * sizeof(T) );
+    }
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_SORTABLE_HPP_INCLUDED
@@ -0,0 +1,97 @@
+#ifndef BOOST_ENDIAN_SPAN_HPP_INCLUDED
+#define BOOST_ENDIAN_SPAN_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+  //  a read-only view of n objects of type T in a byte buffer; T has an
+  //  alignment of 1, typically an unaligned endian_buffer or endian_arithmetic
+  //  type, or a structure of them, so the view can start at any address
+  template<class T> class endian_span;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+template<class T> class endian_span
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<T>::value == 1 );
+
+    T const * p_;
+    std::size_t n_;
+
+public:
+
+    typedef T element_type;
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T const * iterator;
+    typedef T const * const_iterator;
+
+    BOOST_CONSTEXPR endian_span() BOOST_NOEXCEPT: p_( 0 ), n_( 0 )
+    {
+    }
+
+    BOOST_CONSTEXPR endian_span( T const * p, std::size_t n ) BOOST_NOEXCEPT: p_( p ), n_( n )
+    {
+    }
+
+    BOOST_CONSTEXPR T const * data() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+
+    BOOST_CONSTEXPR std::size_t size() const BOOST_NOEXCEPT
+    {
+        return n_;
+    }
+
+    BOOST_CONSTEXPR bool empty() const BOOST_NOEXCEPT
+    {
+        return n_ == 0;
+    }
+
+    BOOST_CONSTEXPR T const * begin() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+
+    BOOST_CONSTEXPR T const * end() const BOOST_NOEXCEPT
+    {
+        return p_ + n_;
+    }
+
+    //  Requires: i < size()
+
+    BOOST_CONSTEXPR T const & operator[]( std::size_t i ) const BOOST_NOEXCEPT
+    {
+        return p_[ i ];
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_SPAN_HPP_INCLUDED
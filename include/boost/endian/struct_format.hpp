@@ -0,0 +1,346 @@
+#ifndef BOOST_ENDIAN_STRUCT_FORMAT_HPP_INCLUDED
+#define BOOST_ENDIAN_STRUCT_FORMAT_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_bulk.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  Record formats given at run time by format strings in the style of the
+//  Python struct module, such as ">IHQ3sx". The format is parsed once into a
+//  plan of byte copies and byte reversals, in which adjacent fields of the
+//  same width are merged into one operation, and the plan is then applied to
+//  single records or arrays of them.
+//
+//  The packed form of a record is its bytes as given by the format. The
+//  unpacked form has the same size and field offsets, with every field in the
+//  native byte order and pad bytes set to zero; it matches a packed C structure
+//  with the same fields.
+
+namespace boost
+{
+namespace endian
+{
+
+  //  a field of a record format; pad bytes are not fields
+  struct struct_field;
+
+  //  a parsed format string
+  class struct_format;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+struct struct_field
+{
+    char code;
+    std::size_t offset;
+    std::size_t size;
+};
+
+namespace detail
+{
+
+// width 0 sets count bytes to zero, width 1 copies count bytes, and width
+// 2, 4 or 8 reverses the bytes of count elements of that width
+
+struct struct_format_op
+{
+    std::size_t width;
+    std::size_t offset;
+    std::size_t count;
+};
+
+// Returns: the standard size of the format character c, or 0 when c is not
+//          supported
+
+inline std::size_t struct_format_size( char c ) BOOST_NOEXCEPT
+{
+    switch( c )
+    {
+    case 'x': case 'c': case 'b': case 'B': case '?': case 's': case 'p':
+        return 1;
+
+    case 'h': case 'H': case 'e':
+        return 2;
+
+    case 'i': case 'I': case 'l': case 'L': case 'f':
+        return 4;
+
+    case 'q': case 'Q': case 'd':
+        return 8;
+
+    default:
+        return 0;
+    }
+}
+
+inline void struct_format_apply( struct_format_op const & op, unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    switch( op.width )
+    {
+    case 0:
+        std::memset( dst, 0, n * op.count );
+        break;
+
+    case 1:
+        detail::endian_copy_bytes( dst, src, n * op.count );
+        break;
+
+    case 2:
+        detail::endian_reverse_n_impl<2>::call( dst, src, n * op.count );
+        break;
+
+    case 4:
+        detail::endian_reverse_n_impl<4>::call( dst, src, n * op.count );
+        break;
+
+    default:
+        detail::endian_reverse_n_impl<8>::call( dst, src, n * op.count );
+        break;
+    }
+}
+
+} // namespace detail
+
+//  struct_format  ---------------------------------------------------------------------//
+
+class struct_format
+{
+private:
+
+    std::vector<detail::struct_format_op> ops_;
+    std::vector<struct_field> fields_;
+    std::size_t size_;
+    order order_;
+    bool valid_;
+
+private:
+
+    void add_op( std::size_t width, std::size_t offset, std::size_t count )
+    {
+        if( count == 0 ) return;
+
+        if( !ops_.empty() && ops_.back().width == width )
+        {
+            ops_.back().count += count;
+        }
+        else
+        {
+            detail::struct_format_op op = { width, offset, count };
+            ops_.push_back( op );
+        }
+    }
+
+    bool parse( char const * p )
+    {
+        switch( *p )
+        {
+        case '<': order_ = order::little; break;
+        case '>': case '!': order_ = order::big; break;
+        case '=': order_ = order::native; break;
+
+        default: return false; // '@' and the native alignment are not supported
+        }
+
+        ++p;
+
+        // the largest count is such that size_ can't overflow
+
+        std::size_t const max_count = static_cast<std::size_t>( -1 ) / 16;
+
+        for( ;; )
+        {
+            while( *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ) ++p;
+
+            if( *p == 0 ) return true;
+
+            std::size_t count = 1;
+
+            if( *p >= '0' && *p <= '9' )
+            {
+                count = 0;
+
+                for( ; *p >= '0' && *p <= '9'; ++p )
+                {
+                    count = count * 10 + static_cast<std::size_t>( *p - '0' );
+                    if( count > max_count ) return false;
+                }
+            }
+
+            char const c = *p++;
+            std::size_t const w = detail::struct_format_size( c );
+
+            if( w == 0 || count * w > max_count - size_ ) return false;
+
+            if( c == 'x' )
+            {
+                add_op( 0, size_, count );
+            }
+            else if( c == 's' || c == 'p' )
+            {
+                struct_field f = { c, size_, count };
+                fields_.push_back( f );
+
+                add_op( 1, size_, count );
+            }
+            else
+            {
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    struct_field f = { c, size_ + i * w, w };
+                    fields_.push_back( f );
+                }
+
+                // in the native byte order, all fields are copied
+
+                if( w == 1 || order_ == order::native )
+                {
+                    add_op( 1, size_, count * w );
+                }
+                else
+                {
+                    add_op( w, size_, count );
+                }
+            }
+
+            size_ += count * w;
+        }
+    }
+
+public:
+
+    struct_format() BOOST_NOEXCEPT: size_( 0 ), order_( order::native ), valid_( false )
+    {
+    }
+
+    //  Effects: parses fmt; when fmt is not a supported format, creates an
+    //           invalid format, for which valid() returns false
+
+    explicit struct_format( char const * fmt ): size_( 0 ), order_( order::native ), valid_( false )
+    {
+        valid_ = parse( fmt );
+
+        if( !valid_ )
+        {
+            ops_.clear();
+            fields_.clear();
+            size_ = 0;
+            order_ = order::native;
+        }
+    }
+
+    explicit struct_format( std::string const & fmt ): struct_format( fmt.c_str() )
+    {
+    }
+
+    bool valid() const BOOST_NOEXCEPT
+    {
+        return valid_;
+    }
+
+    order byte_order() const BOOST_NOEXCEPT
+    {
+        return order_;
+    }
+
+    //  Returns: the size of a record in bytes, as struct.calcsize
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+
+    std::size_t field_count() const BOOST_NOEXCEPT
+    {
+        return fields_.size();
+    }
+
+    //  Requires: i < field_count()
+
+    struct_field const & field( std::size_t i ) const BOOST_NOEXCEPT
+    {
+        return fields_[ i ];
+    }
+
+    //  Returns: the number of operations applied to each record
+
+    std::size_t operation_count() const BOOST_NOEXCEPT
+    {
+        return ops_.size();
+    }
+
+    //  Requires: dst == src, or the ranges of n * size() bytes at dst and src
+    //            do not overlap
+    //
+    //  Effects: stores in dst the n unpacked records at src, packed
+
+    void pack_n( unsigned char const * src, std::size_t n, unsigned char * dst ) const BOOST_NOEXCEPT
+    {
+        // reversing the bytes of a field is its own inverse
+
+        unpack_n( src, n, dst );
+    }
+
+    //  Requires: dst == src, or the ranges of n * size() bytes at dst and src
+    //            do not overlap
+    //
+    //  Effects: stores in dst the n packed records at src, unpacked
+
+    void unpack_n( unsigned char const * src, std::size_t n, unsigned char * dst ) const BOOST_NOEXCEPT
+    {
+        if( n == 0 || ops_.empty() ) return;
+
+        if( ops_.size() == 1 )
+        {
+            // a record of fields of one width is an array of them
+
+            detail::struct_format_apply( ops_[ 0 ], dst, src, n );
+            return;
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            for( std::size_t j = 0; j < ops_.size(); ++j )
+            {
+                detail::struct_format_op const & op = ops_[ j ];
+                detail::struct_format_apply( op, dst + op.offset, src + op.offset, 1 );
+            }
+
+            src += size_;
+            dst += size_;
+        }
+    }
+
+    void pack( unsigned char const * src, unsigned char * dst ) const BOOST_NOEXCEPT
+    {
+        pack_n( src, 1, dst );
+    }
+
+    void unpack( unsigned char const * src, unsigned char * dst ) const BOOST_NOEXCEPT
+    {
+        unpack_n( src, 1, dst );
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_STRUCT_FORMAT_HPP_INCLUDED
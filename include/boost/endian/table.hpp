@@ -0,0 +1,523 @@
+#ifndef BOOST_ENDIAN_TABLE_HPP_INCLUDED
+#define BOOST_ENDIAN_TABLE_HPP_INCLUDED
+
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/span.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/endian_bulk.hpp>
+#include <boost/endian/detail/is_trivially_copyable.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+
+//----------------------------------  synopsis  ----------------------------------------//
+
+//  A little-endian encoding of tables in the style of FlatBuffers. A table
+//  starts with a 32-bit signed offset to its vtable, which lists the position
+//  of each field in the table, or 0 for an absent field. Strings, vectors and
+//  other tables are referenced by 32-bit unsigned offsets, from the field to
+//  the object, which always follows it. Nothing is aligned; all fields are
+//  read with unaligned loads.
+//
+//  Reading does not parse the buffer. Each access checks the offsets it
+//  follows against the size of the buffer, and an absent or out of range
+//  field reads as its default value, an empty vector, or an invalid table.
+
+namespace boost
+{
+namespace endian
+{
+
+  //  a table in the buffer [p, p + n)
+  class endian_table;
+
+  //  Returns: the table referenced by the offset at p, or an invalid table
+  endian_table endian_root_table( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT;
+
+  //  writes a buffer from its end towards its start, so that offsets point forward
+  class endian_table_builder;
+
+} // namespace endian
+} // namespace boost
+
+//----------------------------------  end synopsis  ------------------------------------//
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// types stored as sizeof(T) little-endian bytes
+
+template<class T> struct is_table_scalar: std::integral_constant<bool,
+    ( std::is_integral<T>::value && !std::is_same<T, bool>::value ) || std::is_enum<T>::value ||
+    ( std::is_floating_point<T>::value && ( sizeof(T) == 4 || sizeof(T) == 8 ) )>
+{
+};
+
+// the sizes in a vtable are 16 bits
+
+BOOST_NORETURN inline void throw_table_too_large()
+{
+#if defined(BOOST_NO_EXCEPTIONS)
+
+    std::abort();
+
+#else
+
+    throw std::length_error( "boost::endian::endian_table_builder: the table or its vtable is 64 KiB or larger" );
+
+#endif
+}
+
+} // namespace detail
+
+//  endian_table  ----------------------------------------------------------------------//
+
+class endian_table
+{
+private:
+
+    unsigned char const * p_;
+    std::size_t n_;
+    std::size_t table_;
+    std::size_t vtable_;
+    std::size_t vtable_size_;
+    std::size_t table_size_;
+
+private:
+
+    // Returns: the position of the field in the table, or 0 when the field
+    //          is absent or has fewer than size bytes
+
+    std::size_t field_offset( std::size_t field, std::size_t size ) const BOOST_NOEXCEPT
+    {
+        if( p_ == 0 || field >= ( vtable_size_ - 4 ) / 2 ) return 0;
+
+        std::size_t off = endian_load<std::uint16_t, 2, order::little>( p_ + vtable_ + 4 + 2 * field );
+
+        if( off < 4 || off > table_size_ || size > table_size_ - off ) return 0;
+
+        return off;
+    }
+
+    // Requires: pos <= n_ - 4
+    // Returns: the position referenced by the offset at pos, or 0 when it
+    //          leaves fewer than 4 bytes in the buffer
+
+    std::size_t follow( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        std::uint32_t u = reinterpret_cast<little_uint32_buf_t const*>( p_ + pos )->value();
+        return u > n_ - 4 - pos? 0: pos + u;
+    }
+
+    std::size_t target( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        std::size_t off = field_offset( field, 4 );
+        return off == 0? 0: follow( table_ + off );
+    }
+
+    // Returns: the position of the first element of the vector at pos, and
+    //          its size in n, or 0 when the elements do not fit
+
+    std::size_t vector_at( std::size_t pos, std::size_t size, std::size_t & n ) const BOOST_NOEXCEPT
+    {
+        if( pos == 0 ) return 0;
+
+        std::uint32_t m = reinterpret_cast<little_uint32_buf_t const*>( p_ + pos )->value();
+        if( m > ( n_ - 4 - pos ) / size ) return 0;
+
+        n = m;
+        return pos + 4;
+    }
+
+public:
+
+    endian_table() BOOST_NOEXCEPT: p_( 0 ), n_( 0 ), table_( 0 ), vtable_( 0 ), vtable_size_( 0 ), table_size_( 0 )
+    {
+    }
+
+    //  Effects: validates the table at position pos of the buffer [p, p + n)
+    //           and its vtable; when either does not fit in the buffer, creates
+    //           an invalid table
+
+    endian_table( unsigned char const * p, std::size_t n, std::size_t pos ) BOOST_NOEXCEPT:
+        p_( 0 ), n_( 0 ), table_( 0 ), vtable_( 0 ), vtable_size_( 0 ), table_size_( 0 )
+    {
+        if( n < 4 || pos > n - 4 ) return;
+
+        std::int32_t so = endian_load<std::int32_t, 4, order::little>( p + pos );
+
+        std::size_t vt;
+
+        if( so >= 0 )
+        {
+            if( static_cast<std::uint32_t>( so ) > pos ) return;
+            vt = pos - static_cast<std::uint32_t>( so );
+        }
+        else
+        {
+            std::uint32_t d = 0u - static_cast<std::uint32_t>( so );
+            if( d > n - 4 - pos ) return;
+            vt = pos + d;
+        }
+
+        if( vt > n - 4 ) return;
+
+        std::size_t vs = endian_load<std::uint16_t, 2, order::little>( p + vt );
+        std::size_t ts = endian_load<std::uint16_t, 2, order::little>( p + vt + 2 );
+
+        if( vs < 4 || vs % 2 != 0 || vs > n - vt ) return;
+        if( ts < 4 || ts > n - pos ) return;
+
+        p_ = p;
+        n_ = n;
+        table_ = pos;
+        vtable_ = vt;
+        vtable_size_ = vs;
+        table_size_ = ts;
+    }
+
+    bool valid() const BOOST_NOEXCEPT
+    {
+        return p_ != 0;
+    }
+
+    //  Returns: whether the vtable lists the field
+
+    bool has( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        return field_offset( field, 0 ) != 0;
+    }
+
+    //  Requires: T is integral, enumeration, float or double
+    //  Returns: the value of the field, or def when it is absent
+
+    template<class T> T get( std::size_t field, T def = T() ) const BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_table_scalar<T>::value );
+
+        std::size_t off = field_offset( field, sizeof(T) );
+        return off == 0? def: boost::endian::endian_load<T, sizeof(T), order::little>( p_ + table_ + off );
+    }
+
+    //  Returns: a pointer to the structure stored in the field, or a null
+    //           pointer when it is absent
+
+    template<class S> S const * get_struct( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<S>::value == 1 );
+
+        std::size_t off = field_offset( field, sizeof(S) );
+        return off == 0? 0: reinterpret_cast<S const*>( p_ + table_ + off );
+    }
+
+    endian_table get_table( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        std::size_t pos = target( field );
+        return pos == 0? endian_table(): endian_table( p_, n_, pos );
+    }
+
+    //  Returns: the elements of the vector, viewed as T, typically
+    //           little_int32_buf_t for a vector of std::int32_t
+
+    template<class T> endian_span<T> get_vector( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        std::size_t n = 0;
+        std::size_t pos = vector_at( target( field ), sizeof(T), n );
+
+        return pos == 0? endian_span<T>(): endian_span<T>( reinterpret_cast<T const*>( p_ + pos ), n );
+    }
+
+    //  Returns: the characters of the string, without the terminating null
+
+    endian_span<char> get_string( std::size_t field ) const BOOST_NOEXCEPT
+    {
+        return get_vector<char>( field );
+    }
+
+    //  Returns: the i-th table of a vector of tables, or an invalid table
+
+    endian_table get_table( std::size_t field, std::size_t i ) const BOOST_NOEXCEPT
+    {
+        std::size_t n = 0;
+        std::size_t pos = vector_at( target( field ), 4, n );
+
+        if( pos == 0 || i >= n ) return endian_table();
+
+        pos = follow( pos + 4 * i );
+        return pos == 0? endian_table(): endian_table( p_, n_, pos );
+    }
+};
+
+inline endian_table endian_root_table( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( n < 4 ) return endian_table();
+
+    std::uint32_t u = endian_load<std::uint32_t, 4, order::little>( p );
+    return u > n - 4? endian_table(): endian_table( p, n, u );
+}
+
+//  endian_table_builder  --------------------------------------------------------------//
+
+//  Objects are identified by their distance from the end of the buffer,
+//  which does not change as the buffer grows. Strings, vectors and tables
+//  must be created before the table that references them is started.
+
+class endian_table_builder
+{
+private:
+
+    std::vector<unsigned char> buffer_;
+    std::size_t size_;
+
+    std::size_t table_;
+    std::vector< std::pair<std::size_t, std::uint32_t> > fields_;
+    std::vector<std::uint32_t> vtables_;
+
+private:
+
+    unsigned char * prepend( std::size_t n )
+    {
+        if( buffer_.size() - size_ < n )
+        {
+            std::size_t m = std::max( std::max( buffer_.size() * 2, size_ + n ), static_cast<std::size_t>( 256 ) );
+
+            std::vector<unsigned char> tmp( m );
+            if( size_ != 0 ) std::memcpy( tmp.data() + m - size_, buffer_.data() + buffer_.size() - size_, size_ );
+
+            buffer_.swap( tmp );
+        }
+
+        size_ += n;
+        return buffer_.data() + buffer_.size() - size_;
+    }
+
+    unsigned char * at( std::size_t ref ) BOOST_NOEXCEPT
+    {
+        return buffer_.data() + buffer_.size() - ref;
+    }
+
+    // an offset at the start of the buffer, to the object ref
+
+    void store_offset( unsigned char * p, std::uint32_t ref ) BOOST_NOEXCEPT
+    {
+        endian_store<std::uint32_t, 4, order::little>( p, static_cast<std::uint32_t>( size_ - ref ) );
+    }
+
+    void add_field( std::size_t field )
+    {
+        fields_.push_back( std::make_pair( field, static_cast<std::uint32_t>( size_ ) ) );
+    }
+
+public:
+
+    endian_table_builder(): size_( 0 ), table_( 0 )
+    {
+    }
+
+    //  Effects: reserves space for n bytes
+
+    explicit endian_table_builder( std::size_t n ): buffer_( n ), size_( 0 ), table_( 0 )
+    {
+    }
+
+    std::uint32_t create_string( char const * s, std::size_t n )
+    {
+        unsigned char * p = prepend( 4 + n + 1 );
+
+        endian_store<std::uint32_t, 4, order::little>( p, static_cast<std::uint32_t>( n ) );
+        std::memcpy( p + 4, s, n );
+        p[ 4 + n ] = 0;
+
+        return static_cast<std::uint32_t>( size_ );
+    }
+
+    std::uint32_t create_string( std::string const & s )
+    {
+        return create_string( s.data(), s.size() );
+    }
+
+    //  Requires: T is integral, enumeration, float or double
+
+    template<class T> std::uint32_t create_vector( T const * first, std::size_t n )
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_table_scalar<T>::value );
+
+        unsigned char * p = prepend( 4 + n * sizeof(T) );
+
+        endian_store<std::uint32_t, 4, order::little>( p, static_cast<std::uint32_t>( n ) );
+        boost::endian::endian_store_n<T, order::little>( first, n, p + 4 );
+
+        return static_cast<std::uint32_t>( size_ );
+    }
+
+    //  Requires: S is trivially copyable with an alignment of 1, typically a
+    //            structure of little-endian buffers
+
+    template<class S> std::uint32_t create_struct_vector( S const * first, std::size_t n )
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<S>::value == 1 );
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<S>::value );
+
+        unsigned char * p = prepend( 4 + n * sizeof(S) );
+
+        endian_store<std::uint32_t, 4, order::little>( p, static_cast<std::uint32_t>( n ) );
+        if( n != 0 ) std::memcpy( p + 4, first, n * sizeof(S) );
+
+        return static_cast<std::uint32_t>( size_ );
+    }
+
+    //  Effects: creates a vector of offsets to the objects first[i], i < n,
+    //           read as a vector of tables by endian_table::get_table( field, i )
+
+    std::uint32_t create_offset_vector( std::uint32_t const * first, std::size_t n )
+    {
+        unsigned char * p = prepend( 4 + n * 4 );
+
+        endian_store<std::uint32_t, 4, order::little>( p, static_cast<std::uint32_t>( n ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            // the element i is at the distance size_ - 4 - 4 * i from the end
+            endian_store<std::uint32_t, 4, order::little>( p + 4 + 4 * i, static_cast<std::uint32_t>( size_ - 4 - 4 * i - first[ i ] ) );
+        }
+
+        return static_cast<std::uint32_t>( size_ );
+    }
+
+    void start_table()
+    {
+        fields_.clear();
+        table_ = size_;
+    }
+
+    //  Requires: T is integral, enumeration, float or double
+
+    template<class T> void add( std::size_t field, T v )
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_table_scalar<T>::value );
+
+        boost::endian::endian_store<T, sizeof(T), order::little>( prepend( sizeof(T) ), v );
+        add_field( field );
+    }
+
+    //  Requires: S is trivially copyable with an alignment of 1
+
+    template<class S> void add_struct( std::size_t field, S const & s )
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<S>::value == 1 );
+        BOOST_ENDIAN_STATIC_ASSERT( detail::is_trivially_copyable<S>::value );
+
+        std::memcpy( prepend( sizeof(S) ), &s, sizeof(S) );
+        add_field( field );
+    }
+
+    //  Effects: adds a field referencing the string, vector or table ref
+
+    void add_offset( std::size_t field, std::uint32_t ref )
+    {
+        store_offset( prepend( 4 ), ref );
+        add_field( field );
+    }
+
+    //  Effects: completes the table; identical vtables are shared
+    //  Returns: the table
+    //  Throws: std::length_error when the table or its vtable is 64 KiB or larger
+
+    std::uint32_t end_table()
+    {
+        std::size_t slots = 0;
+
+        for( std::size_t i = 0; i < fields_.size(); ++i )
+        {
+            slots = std::max( slots, fields_[ i ].first + 1 );
+        }
+
+        // the fields follow the offset to the vtable, so their offsets are
+        // smaller than the size of the table; checked before the buffer is
+        // changed
+
+        if( size_ + 4 - table_ > 0xFFFF || slots > ( 0xFFFF - 4 ) / 2 )
+        {
+            detail::throw_table_too_large();
+        }
+
+        prepend( 4 );
+
+        std::size_t const t = size_;
+
+        std::vector<unsigned char> vt( 4 + 2 * slots );
+
+        endian_store<std::uint16_t, 2, order::little>( vt.data(), static_cast<std::uint16_t>( vt.size() ) );
+        endian_store<std::uint16_t, 2, order::little>( vt.data() + 2, static_cast<std::uint16_t>( t - table_ ) );
+
+        for( std::size_t i = 0; i < fields_.size(); ++i )
+        {
+            endian_store<std::uint16_t, 2, order::little>( vt.data() + 4 + 2 * fields_[ i ].first, static_cast<std::uint16_t>( t - fields_[ i ].second ) );
+        }
+
+        // the offset from the table to its vtable is table - vtable; a new
+        // vtable precedes the table, a shared one follows it
+
+        for( std::size_t i = 0; i < vtables_.size(); ++i )
+        {
+            unsigned char const * v = at( vtables_[ i ] );
+
+            if( endian_load<std::uint16_t, 2, order::little>( v ) == vt.size() && std::memcmp( v, vt.data(), vt.size() ) == 0 )
+            {
+                endian_store<std::int32_t, 4, order::little>( at( t ), static_cast<std::int32_t>( vtables_[ i ] ) - static_cast<std::int32_t>( t ) );
+                return static_cast<std::uint32_t>( t );
+            }
+        }
+
+        std::memcpy( prepend( vt.size() ), vt.data(), vt.size() );
+        vtables_.push_back( static_cast<std::uint32_t>( size_ ) );
+
+        endian_store<std::int32_t, 4, order::little>( at( t ), static_cast<std::int32_t>( size_ - t ) );
+
+        return static_cast<std::uint32_t>( t );
+    }
+
+    //  Effects: stores the offset to the root table at the start of the buffer
+
+    void finish( std::uint32_t root )
+    {
+        store_offset( prepend( 4 ), root );
+    }
+
+    //  Returns: the buffer, size() bytes
+
+    unsigned char const * data() const BOOST_NOEXCEPT
+    {
+        return buffer_.data() + buffer_.size() - size_;
+    }
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_TABLE_HPP_INCLUDED
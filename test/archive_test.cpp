@@ -0,0 +1,303 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/archive.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+namespace app
+{
+
+enum class color: std::uint16_t { red = 1, green = 0x0203 };
+
+// member serialize
+
+struct sample
+{
+    std::int32_t id;
+    double value;
+    color c;
+    bool flag;
+
+    template<class Archive> void serialize( Archive & ar )
+    {
+        ar & id & value & c & flag;
+    }
+};
+
+bool operator==( sample const & a, sample const & b )
+{
+    return a.id == b.id && a.value == b.value && a.c == b.c && a.flag == b.flag;
+}
+
+// free serialize, found by argument dependent lookup
+
+struct series
+{
+    std::string name;
+    std::vector<double> values;
+    std::vector<std::int32_t> ids;
+    std::vector<sample> samples;
+    std::array<std::uint16_t, 3> tag;
+    std::int8_t small[ 2 ];
+};
+
+template<class Archive> void serialize( Archive & ar, series & s )
+{
+    ar & s.name & s.values & s.ids & s.samples & s.tag & s.small;
+}
+
+} // namespace app
+
+static app::series make_series()
+{
+    app::series s;
+
+    s.name = "pressure";
+
+    for( int i = 0; i < 100; ++i )
+    {
+        s.values.push_back( i * 0.25 - 3 );
+        s.ids.push_back( i * 0x01010101 - 7 );
+    }
+
+    app::sample a = { -5, 1.5, app::color::green, true };
+    app::sample b = { 0x7FFFFFFF, -0.0, app::color::red, false };
+
+    s.samples.push_back( a );
+    s.samples.push_back( b );
+
+    s.tag[ 0 ] = 1; s.tag[ 1 ] = 0x1234; s.tag[ 2 ] = 0xFFFF;
+    s.small[ 0 ] = -1; s.small[ 1 ] = 5;
+
+    return s;
+}
+
+static void test_series_equal( app::series const & a, app::series const & b )
+{
+    BOOST_TEST( a.name == b.name );
+    BOOST_TEST_ALL_EQ( a.values.begin(), a.values.end(), b.values.begin(), b.values.end() );
+    BOOST_TEST_ALL_EQ( a.ids.begin(), a.ids.end(), b.ids.begin(), b.ids.end() );
+    BOOST_TEST( a.samples == b.samples );
+    BOOST_TEST( a.tag == b.tag );
+    BOOST_TEST_EQ( a.small[ 0 ], b.small[ 0 ] );
+    BOOST_TEST_EQ( a.small[ 1 ], b.small[ 1 ] );
+}
+
+template<order Order> static void test_round_trip()
+{
+    app::series s = make_series();
+
+    std::vector<unsigned char> buffer;
+
+    {
+        binary_oarchive<Order> ar( buffer );
+        ar << s;
+    }
+
+    // 8 + 8 name, 8 + 800 values, 8 + 400 ids, 8 + 2 * 15 samples, 6 tag, 2 small
+    BOOST_TEST_EQ( buffer.size(), 1278u );
+
+    app::series t;
+
+    binary_iarchive<Order> ar( buffer.data(), buffer.size() );
+    ar >> t;
+
+    BOOST_TEST( !ar.overrun() );
+    BOOST_TEST_EQ( ar.remaining(), 0u );
+
+    test_series_equal( s, t );
+}
+
+static void test_layout()
+{
+    std::vector<unsigned char> buffer;
+    little_binary_oarchive ar( buffer );
+
+    std::vector<std::uint16_t> v;
+    v.push_back( 0x0102 );
+    v.push_back( 0x0304 );
+
+    ar & std::uint32_t( 0x01020304 ) & true & app::color::green & v & std::string( "ab" );
+
+    unsigned char const expected[] =
+    {
+        0x04, 0x03, 0x02, 0x01,
+        0x01,
+        0x03, 0x02,
+        0x02, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x01, 0x04, 0x03,
+        0x02, 0, 0, 0, 0, 0, 0, 0, 'a', 'b',
+    };
+
+    BOOST_TEST_ALL_EQ( buffer.begin(), buffer.end(), expected + 0, expected + sizeof(expected) );
+}
+
+static void test_big_layout()
+{
+    std::vector<unsigned char> buffer;
+    big_binary_oarchive ar( buffer );
+
+    std::vector<std::int32_t> v;
+    v.push_back( 0x01020304 );
+
+    ar & v & 1.0f;
+
+    unsigned char const expected[] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0x01, 0x01, 0x02, 0x03, 0x04,
+        0x3F, 0x80, 0, 0,
+    };
+
+    BOOST_TEST_ALL_EQ( buffer.begin(), buffer.end(), expected + 0, expected + sizeof(expected) );
+}
+
+// the bulk path writes the same bytes as element by element writes
+
+template<class T, order Order> static void test_bulk_matches_scalar()
+{
+    std::vector<T> v;
+
+    for( int i = 0; i < 37; ++i )
+    {
+        v.push_back( static_cast<T>( i * 0x0101010101LL + 3 ) );
+    }
+
+    std::vector<unsigned char> b1, b2;
+
+    binary_oarchive<Order> ar1( b1 );
+    ar1 & v;
+
+    binary_oarchive<Order> ar2( b2 );
+    ar2 & static_cast<std::uint64_t>( v.size() );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        ar2 & v[ i ];
+    }
+
+    BOOST_TEST_ALL_EQ( b1.begin(), b1.end(), b2.begin(), b2.end() );
+}
+
+static void test_vector_bool()
+{
+    std::vector<bool> v;
+
+    for( int i = 0; i < 11; ++i )
+    {
+        v.push_back( i % 3 == 0 );
+    }
+
+    std::vector<unsigned char> buffer;
+
+    big_binary_oarchive oa( buffer );
+    oa & v & std::vector<bool>();
+
+    unsigned char const expected[] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 11, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    BOOST_TEST_ALL_EQ( buffer.begin(), buffer.end(), expected + 0, expected + sizeof(expected) );
+
+    {
+        std::vector<bool> w( 3, true ), e( 2, true );
+
+        big_binary_iarchive ar( buffer.data(), buffer.size() );
+        ar & w & e;
+
+        BOOST_TEST( w == v );
+        BOOST_TEST( e.empty() );
+        BOOST_TEST( !ar.overrun() );
+        BOOST_TEST_EQ( ar.remaining(), 0u );
+    }
+
+    // a size larger than the input
+
+    {
+        std::vector<bool> w( 3, true );
+
+        big_binary_iarchive ar( buffer.data(), 12 );
+        ar & w;
+
+        BOOST_TEST( w.empty() );
+        BOOST_TEST( ar.overrun() );
+    }
+}
+
+static void test_overrun()
+{
+    app::series s = make_series();
+
+    std::vector<unsigned char> buffer;
+
+    little_binary_oarchive oa( buffer );
+    oa & s;
+
+    for( std::size_t n = 0; n < buffer.size(); n += 7 )
+    {
+        app::series t;
+
+        little_binary_iarchive ar( buffer.data(), n );
+        ar & t;
+
+        BOOST_TEST( ar.overrun() );
+        BOOST_TEST_EQ( ar.remaining(), 0u );
+    }
+
+    // a size larger than the input
+
+    {
+        unsigned char const data[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 1, 2, 3, 4 };
+
+        std::vector<double> v( 3 );
+        std::uint32_t x = 5;
+
+        little_binary_iarchive ar( data, sizeof(data) );
+        ar & v & x;
+
+        BOOST_TEST( ar.overrun() );
+        BOOST_TEST( v.empty() );
+        BOOST_TEST_EQ( x, 0u );
+    }
+
+    {
+        unsigned char const data[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 1, 2, 3, 4 };
+
+        std::vector<app::sample> v;
+
+        little_binary_iarchive ar( data, sizeof(data) );
+        ar & v;
+
+        BOOST_TEST( ar.overrun() );
+        BOOST_TEST_LE( v.size(), 1u );
+    }
+}
+
+int main()
+{
+    test_round_trip<order::little>();
+    test_round_trip<order::big>();
+
+    test_layout();
+    test_big_layout();
+
+    test_bulk_matches_scalar<std::uint16_t, order::little>();
+    test_bulk_matches_scalar<std::int32_t, order::little>();
+    test_bulk_matches_scalar<std::uint64_t, order::big>();
+    test_bulk_matches_scalar<double, order::little>();
+    test_bulk_matches_scalar<float, order::big>();
+
+    test_vector_bool();
+    test_overrun();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/arithmetic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+// value() == y, with the usual arithmetic conversions
+
+template<class T, class U> static bool equal_values( T x, U y )
+{
+    typedef decltype( x + y ) C;
+    return static_cast<C>( x ) == static_cast<C>( y );
+}
+
+static std::uint64_t const values[] =
+{
+    0, 1, 2, 0x7F, 0x80, 0xFF, 0x100, 0x7FFF, 0x8000, 0xFFFF, 0x10000,
+    0x7FFFFF, 0x800000, 0xFFFFFF, 0x1000000, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF,
+    0x100000000, 0xFFFFFFFFFF, 0xFFFFFFFFFFFF, 0xFFFFFFFFFFFFFF,
+    0x0102030405060708, 0x7FFFFFFFFFFFFFFF, 0x8000000000000000,
+    0xFFFFFFFFFFFFFF00, 0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF,
+};
+
+std::size_t const N = sizeof( values ) / sizeof( values[ 0 ] );
+
+template<class E, class U> static void test_equal( E const & x )
+{
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        U const y = static_cast<U>( values[ i ] );
+        bool const r = equal_values( x.value(), y );
+
+        BOOST_TEST_EQ( x == y, r );
+        BOOST_TEST_EQ( y == x, r );
+        BOOST_TEST_EQ( x != y, !r );
+        BOOST_TEST_EQ( y != x, !r );
+    }
+}
+
+template<class E> static void test()
+{
+    typedef typename E::value_type T;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        E x( static_cast<T>( values[ i ] ) );
+
+        test_equal<E, signed char>( x );
+        test_equal<E, unsigned char>( x );
+        test_equal<E, short>( x );
+        test_equal<E, unsigned short>( x );
+        test_equal<E, int>( x );
+        test_equal<E, unsigned>( x );
+        test_equal<E, long long>( x );
+        test_equal<E, unsigned long long>( x );
+        test_equal<E, bool>( x );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            T const v = x.value();
+            T const w = static_cast<T>( values[ j ] );
+
+            E y( w );
+
+            BOOST_TEST_EQ( ( E( x ) &= w ).value(), E( static_cast<T>( v & w ) ).value() );
+            BOOST_TEST_EQ( ( E( x ) |= w ).value(), E( static_cast<T>( v | w ) ).value() );
+            BOOST_TEST_EQ( ( E( x ) ^= w ).value(), E( static_cast<T>( v ^ w ) ).value() );
+
+            BOOST_TEST_EQ( ( E( x ) &= y ).value(), E( static_cast<T>( v & y.value() ) ).value() );
+            BOOST_TEST_EQ( ( E( x ) |= y ).value(), E( static_cast<T>( v | y.value() ) ).value() );
+            BOOST_TEST_EQ( ( E( x ) ^= y ).value(), E( static_cast<T>( v ^ y.value() ) ).value() );
+
+            BOOST_TEST_EQ( x == y, v == y.value() );
+            BOOST_TEST_EQ( x != y, v != y.value() );
+        }
+    }
+}
+
+static void test_representable()
+{
+    big_uint24_t x( 0xFFFFFF );
+
+    BOOST_TEST( x == 0xFFFFFF );
+    BOOST_TEST( x != 0x1FFFFFF );
+    BOOST_TEST( x != -1 );
+
+    big_int24_t y( -1 );
+
+    BOOST_TEST( y == -1 );
+    BOOST_TEST( y != 0xFFFFFF );
+    BOOST_TEST( y == -1LL );
+
+    big_uint32_t z( 0xFFFFFFFF );
+
+    BOOST_TEST( z == -1 );
+    BOOST_TEST( z != -1LL );
+    BOOST_TEST( z == 0xFFFFFFFFu );
+}
+
+static void test_float()
+{
+    big_float32_t x( 1.0f );
+
+    BOOST_TEST( x == 1 );
+    BOOST_TEST( 1 == x );
+    BOOST_TEST( x != 2 );
+
+    little_float64_t y( -0.0 );
+
+    BOOST_TEST( y == 0 );
+}
+
+static void test_literals()
+{
+    using namespace boost::endian::literals;
+
+    big_uint32_t x = 0xCAFEBABE_be32;
+
+    unsigned char const b32[] = { 0xCA, 0xFE, 0xBA, 0xBE };
+    BOOST_TEST_EQ( std::memcmp( x.data(), b32, 4 ), 0 );
+
+    little_uint16_t y = 0x0102_le16;
+
+    unsigned char const l16[] = { 0x02, 0x01 };
+    BOOST_TEST_EQ( std::memcmp( y.data(), l16, 2 ), 0 );
+
+    BOOST_TEST( x == 0xCAFEBABE_be32 );
+    BOOST_TEST( x != 0xCAFEBABF_be32 );
+
+    x &= 0xFF00FF00_be32;
+    BOOST_TEST_EQ( x.value(), 0xCA00BA00u );
+
+    x |= 0x000000FF_be32;
+    BOOST_TEST_EQ( x.value(), 0xCA00BAFFu );
+
+    x ^= 0xFFFFFFFF_be32;
+    BOOST_TEST_EQ( x.value(), 0x35FF4500u );
+
+    BOOST_TEST_EQ( ( 0x0102030405060708_be64 ).value(), 0x0102030405060708u );
+    BOOST_TEST_EQ( ( 0x0102030405060708_le64 ).value(), 0x0102030405060708u );
+    BOOST_TEST_EQ( ( 0x1234_be16 ).value(), 0x1234u );
+    BOOST_TEST_EQ( ( 0x12345678_le32 ).value(), 0x12345678u );
+
+    // decimal and octal, up to the largest value of the type
+    BOOST_TEST_EQ( ( 65535_be16 ).value(), 0xFFFFu );
+    BOOST_TEST_EQ( ( 0177777_le16 ).value(), 0xFFFFu );
+    BOOST_TEST_EQ( ( 0_le32 ).value(), 0u );
+    BOOST_TEST_EQ( ( 0XFFFFFFFF_le32 ).value(), 0xFFFFFFFFu );
+    BOOST_TEST_EQ( ( 18446744073709551615_be64 ).value(), 0xFFFFFFFFFFFFFFFFu );
+}
+
+int main()
+{
+    test<big_uint8_t>();
+    test<big_int8_t>();
+    test<big_uint16_t>();
+    test<little_int16_t>();
+    test<big_uint24_t>();
+    test<little_int24_t>();
+    test<big_uint32_t>();
+    test<little_int32_t>();
+    test<big_int40_t>();
+    test<little_uint48_t>();
+    test<big_int56_t>();
+    test<little_uint64_t>();
+    test<big_int64_t>();
+    test<native_int24_t>();
+
+    test<big_uint16_at>();
+    test<little_int32_at>();
+    test<big_uint64_at>();
+
+    test_representable();
+    test_float();
+    test_literals();
+
+    return boost::report_errors();
+}
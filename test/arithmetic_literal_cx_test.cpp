@@ -0,0 +1,35 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/arithmetic.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <boost/config.hpp>
+
+#if !defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because BOOST_ENDIAN_CONSTEXPR_LOAD_STORE is not defined")
+
+#else
+
+using namespace boost::endian;
+using namespace boost::endian::literals;
+
+#define STATIC_ASSERT(expr) static_assert(expr, #expr)
+
+constexpr big_uint32_t x = 0xCAFEBABE_be32;
+
+STATIC_ASSERT( x.value() == 0xCAFEBABE );
+
+constexpr little_uint16_t y = 0x0102_le16;
+
+STATIC_ASSERT( y.value() == 0x0102 );
+
+STATIC_ASSERT( ( 0xFFFF_be16 ).value() == 0xFFFF );
+STATIC_ASSERT( ( 1000000_le32 ).value() == 1000000 );
+STATIC_ASSERT( ( 0b1010_be32 ).value() == 10 );
+STATIC_ASSERT( ( 0x0102030405060708_be64 ).value() == 0x0102030405060708 );
+STATIC_ASSERT( ( 0x0102030405060708_le64 ).value() == 0x0102030405060708 );
+
+#endif
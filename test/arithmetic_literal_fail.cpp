@@ -0,0 +1,15 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/arithmetic.hpp>
+
+using namespace boost::endian::literals;
+
+// a literal that doesn't fit in the type is rejected
+
+int main()
+{
+    return ( 0x12345_be16 ).value() != 0;
+}
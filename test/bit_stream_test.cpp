@@ -0,0 +1,233 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/bit_stream.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+static std::uint64_t widths_value( unsigned i, unsigned w )
+{
+    std::uint64_t v = 0x9E3779B97F4A7C15ULL * ( i + 1 );
+    return w == 64? v: v & ( ( static_cast<std::uint64_t>( 1 ) << w ) - 1 );
+}
+
+template<order Order> static void test_roundtrip()
+{
+    unsigned char buffer[ 1024 ] = {};
+
+    std::size_t bits = 0;
+
+    {
+        bit_writer<Order> w( buffer, sizeof( buffer ) );
+
+        for( unsigned i = 0; i < 200; ++i )
+        {
+            unsigned n = i % 65;
+
+            w.write( widths_value( i, n ), n );
+            bits += n;
+
+            BOOST_TEST_EQ( w.position(), bits );
+        }
+
+        BOOST_TEST_EQ( w.flush(), ( bits + 7 ) / 8 );
+        BOOST_TEST( !w.overflow() );
+    }
+
+    {
+        bit_reader<Order> r( buffer, ( bits + 7 ) / 8 );
+
+        for( unsigned i = 0; i < 200; ++i )
+        {
+            unsigned n = i % 65;
+            BOOST_TEST_EQ( r.read( n ), widths_value( i, n ) );
+        }
+
+        BOOST_TEST_EQ( r.position(), bits );
+        BOOST_TEST_LT( r.bits_left(), 8u );
+        BOOST_TEST( !r.overrun() );
+    }
+}
+
+static void test_big()
+{
+    // MPEG-TS packet header: sync_byte, TEI, PUSI, priority, PID, TSC, AFC, CC
+
+    unsigned char const ts[] = { 0x47, 0x41, 0x00, 0x1C };
+
+    {
+        big_bit_reader r( ts, sizeof( ts ) );
+
+        BOOST_TEST_EQ( r.read( 8 ), 0x47u );
+        BOOST_TEST_EQ( r.read_bit(), false );
+        BOOST_TEST_EQ( r.read_bit(), true );
+        BOOST_TEST_EQ( r.read_bit(), false );
+        BOOST_TEST_EQ( r.peek( 13 ), 0x100u );
+        BOOST_TEST_EQ( r.read( 13 ), 0x100u );
+        BOOST_TEST_EQ( r.read( 2 ), 0u );
+        BOOST_TEST_EQ( r.read( 2 ), 1u );
+        BOOST_TEST_EQ( r.read( 4 ), 0xCu );
+
+        BOOST_TEST_EQ( r.bits_left(), 0u );
+        BOOST_TEST( !r.overrun() );
+
+        BOOST_TEST_EQ( r.read( 4 ), 0u );
+        BOOST_TEST( r.overrun() );
+    }
+
+    typedef bit_layout<order::big, 8, 1, 1, 1, 13, 2, 2, 4> ts_header;
+
+    BOOST_TEST_EQ( ts_header::size, 8u );
+    BOOST_TEST_EQ( ts_header::size_bits, 32u );
+    BOOST_TEST_EQ( ts_header::size_bytes, 4u );
+
+    BOOST_TEST_EQ( ts_header::get<0>( ts ), 0x47u );
+    BOOST_TEST_EQ( ts_header::get<2>( ts ), 1u );
+    BOOST_TEST_EQ( ts_header::get<4>( ts ), 0x100u );
+    BOOST_TEST_EQ( ts_header::get<6>( ts ), 1u );
+    BOOST_TEST_EQ( ts_header::get<7>( ts ), 0xCu );
+
+    {
+        unsigned char buffer[ 4 ] = {};
+
+        big_bit_writer w( buffer, sizeof( buffer ) );
+
+        w.write( 0x47, 8 );
+        w.write_bit( false );
+        w.write_bit( true );
+        w.write_bit( false );
+        w.write( 0x100, 13 );
+        w.write( 0, 2 );
+        w.write( 1, 2 );
+        w.write( 0xC, 4 );
+
+        BOOST_TEST_EQ( w.flush(), 4u );
+        BOOST_TEST( !w.overflow() );
+
+        BOOST_TEST_EQ( std::memcmp( buffer, ts, 4 ), 0 );
+
+        ts_header::set<4>( buffer, 0x1FFF );
+        ts_header::set<7>( buffer, 0x3 );
+
+        BOOST_TEST_EQ( buffer[0], 0x47 );
+        BOOST_TEST_EQ( buffer[1], 0x5F );
+        BOOST_TEST_EQ( buffer[2], 0xFF );
+        BOOST_TEST_EQ( buffer[3], 0x13 );
+
+        w.write( 1, 1 );
+        w.flush();
+
+        BOOST_TEST( w.overflow() );
+    }
+}
+
+static void test_little()
+{
+    // LSB-first: the first field occupies the low bits of the first byte
+
+    unsigned char const v[] = { 0xA5, 0x3C };
+
+    little_bit_reader r( v, sizeof( v ) );
+
+    BOOST_TEST_EQ( r.read( 3 ), 5u );
+    BOOST_TEST_EQ( r.read( 5 ), 0x14u );
+    BOOST_TEST_EQ( r.read_signed( 4 ), -4 );
+    BOOST_TEST_EQ( r.read( 4 ), 3u );
+
+    typedef bit_layout<order::little, 3, 5, 4, 4> layout;
+
+    BOOST_TEST_EQ( layout::get<0>( v ), 5u );
+    BOOST_TEST_EQ( layout::get<1>( v ), 0x14u );
+    BOOST_TEST_EQ( (layout::field<2, std::int8_t>::get( v )), -4 );
+    BOOST_TEST_EQ( layout::get<3>( v ), 3u );
+
+    unsigned char w[ 2 ] = {};
+
+    layout::set<0>( w, 5 );
+    layout::set<1>( w, 0x14 );
+    layout::field<2, std::int8_t>::set( w, -4 );
+    layout::set<3>( w, 3 );
+
+    BOOST_TEST_EQ( w[0], 0xA5 );
+    BOOST_TEST_EQ( w[1], 0x3C );
+}
+
+static void test_field()
+{
+    unsigned char v[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01 };
+
+    BOOST_TEST_EQ( (bit_field<4, 60>::get( v )), 0x123456789ABCDEFULL );
+    BOOST_TEST_EQ( (bit_field<4, 12, order::big, std::int16_t>::get( v )), 0x123 );
+    BOOST_TEST_EQ( (bit_field<8, 8, order::big, std::int8_t>::get( v )), 0x23 );
+    BOOST_TEST_EQ( (bit_field<32, 8, order::big, std::int8_t>::get( v )), -0x77 );
+
+    BOOST_TEST_EQ( (bit_field<8, 32, order::little>::get( v )), 0x89674523u );
+    BOOST_TEST_EQ( (bit_field<12, 8, order::little>::get( v )), 0x52u );
+
+    bit_field<7, 57, order::big>::set( v, 0 );
+
+    BOOST_TEST_EQ( v[0], 0x00 );
+    BOOST_TEST_EQ( v[7], 0x00 );
+    BOOST_TEST_EQ( v[8], 0x01 );
+}
+
+static void test_skip()
+{
+    unsigned char v[ 32 ];
+
+    for( unsigned i = 0; i < sizeof( v ); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i );
+    }
+
+    big_bit_reader r( v, sizeof( v ) );
+
+    r.skip( 4 );
+    BOOST_TEST_EQ( r.read( 8 ), 0x00u );
+    r.skip( 100 );
+    BOOST_TEST_EQ( r.position(), 112u );
+    BOOST_TEST_EQ( r.read( 8 ), 14u );
+    r.read_bit();
+    r.align();
+    BOOST_TEST_EQ( r.position(), 128u );
+    BOOST_TEST_EQ( r.read( 16 ), 0x1011u );
+    r.skip( 1000 );
+    BOOST_TEST( r.overrun() );
+    BOOST_TEST_EQ( r.bits_left(), 0u );
+}
+
+template<order Order> static void test_skip_whole_cache()
+{
+    unsigned char v[ 7 ] = { 1, 2, 3, 4, 5, 6, 7 };
+
+    bit_reader<Order> r( v, sizeof( v ) );
+
+    r.peek( 1 );
+    r.skip( 64 );
+
+    BOOST_TEST_EQ( r.position(), 64u );
+    BOOST_TEST_EQ( r.bits_left(), 0u );
+    BOOST_TEST( r.overrun() );
+    BOOST_TEST_EQ( r.read( 8 ), 0u );
+}
+
+int main()
+{
+    test_roundtrip<order::big>();
+    test_roundtrip<order::little>();
+
+    test_big();
+    test_little();
+    test_field();
+    test_skip();
+    test_skip_whole_cache<order::big>();
+    test_skip_whole_cache<order::little>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/shuffle.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+template<class T> static void test_planes( std::size_t n )
+{
+    std::size_t const N = sizeof(T);
+
+    T v[ 100 ];
+
+    std::uint64_t x = 1;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        v[ i ] = static_cast<T>( x >> 17 );
+    }
+
+    unsigned char big[ 100 * 8 ], little[ 100 * 8 ];
+
+    endian_store_n<T, order::big>( v, n, big );
+    endian_store_n<T, order::little>( v, n, little );
+
+    unsigned char p1[ 100 * 8 ], p2[ 100 * 8 ], p3[ 100 * 8 ];
+
+    byte_shuffle_n<N, order::big>( big, n, p1 );
+    byte_shuffle_n<N, order::little>( little, n, p2 );
+    byte_shuffle_n<N, order::native>( reinterpret_cast<unsigned char const*>( v ), n, p3 );
+
+    // the planes are the same regardless of the source byte order
+
+    BOOST_TEST_EQ( std::memcmp( p1, p2, n * N ), 0 );
+    BOOST_TEST_EQ( std::memcmp( p1, p3, n * N ), 0 );
+
+    // plane k holds bits [8k, 8k+8) of every element
+
+    for( std::size_t k = 0; k < N; ++k )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( p1[ k * n + i ], static_cast<unsigned char>( static_cast<std::uint64_t>( v[ i ] ) >> ( 8 * k ) ) );
+        }
+    }
+
+    unsigned char r1[ 100 * 8 ], r2[ 100 * 8 ];
+
+    byte_unshuffle_n<N, order::big>( p1, n, r1 );
+    byte_unshuffle_n<N, order::little>( p1, n, r2 );
+
+    BOOST_TEST_EQ( std::memcmp( r1, big, n * N ), 0 );
+    BOOST_TEST_EQ( std::memcmp( r2, little, n * N ), 0 );
+}
+
+static void test_example()
+{
+    unsigned char const src[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    unsigned char dst[ 8 ];
+
+    byte_shuffle_n<4, order::big>( src, 2, dst );
+
+    unsigned char const expected[] = { 0x04, 0x08, 0x03, 0x07, 0x02, 0x06, 0x01, 0x05 };
+
+    BOOST_TEST_EQ( std::memcmp( dst, expected, 8 ), 0 );
+}
+
+int main()
+{
+    std::size_t const sizes[] = { 0, 1, 3, 16, 17, 64, 99 };
+
+    for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+    {
+        test_planes<std::uint16_t>( sizes[ i ] );
+        test_planes<std::int32_t>( sizes[ i ] );
+        test_planes<std::uint64_t>( sizes[ i ] );
+    }
+
+    test_example();
+
+    return boost::report_errors();
+}
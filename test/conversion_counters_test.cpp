@@ -0,0 +1,204 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Built with and without BOOST_ENDIAN_ENABLE_COUNTERS
+
+#include <boost/endian/counters.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/record.hpp>
+#include <boost/endian/shuffle.hpp>
+#include <boost/endian/pcm.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+static std::uint64_t expected( std::uint64_t n )
+{
+    return conversion_counters_enabled? n: 0;
+}
+
+static void test_reverse()
+{
+    conversion_counters c1 = this_thread_conversion_counters();
+
+    std::uint32_t x = 0x01020304;
+
+    x = endian_reverse( x );
+    endian_reverse_inplace( x );
+
+    std::uint64_t y = 1;
+    endian_reverse_inplace( y );
+
+    BOOST_TEST_EQ( x, 0x01020304u );
+    BOOST_TEST_EQ( y, 0x0100000000000000ULL );
+
+    conversion_counters d = this_thread_conversion_counters() - c1;
+
+#if defined(BOOST_ENDIAN_COUNT_CONSTEXPR_REVERSE) || !defined(BOOST_ENDIAN_ENABLE_COUNTERS)
+
+    BOOST_TEST_EQ( d.reverse[ 2 ].calls, expected( 2 ) );
+    BOOST_TEST_EQ( d.reverse[ 2 ].bytes, expected( 8 ) );
+
+#else
+
+    BOOST_TEST_EQ( d.reverse[ 2 ].calls, expected( 1 ) );
+
+#endif
+
+    BOOST_TEST_EQ( d.reverse[ 3 ].calls, expected( 1 ) );
+    BOOST_TEST_EQ( d.reverse[ 3 ].bytes, expected( 8 ) );
+
+    BOOST_TEST_EQ( d.reverse[ 0 ].calls, 0u );
+    BOOST_TEST_EQ( d.reverse[ 1 ].calls, 0u );
+}
+
+static void test_load_store()
+{
+    conversion_counters c1 = this_thread_conversion_counters();
+
+    unsigned char v[ 8 ] = {};
+
+    store_big_u32( v, 0x01020304 );
+    store_little_u24( v + 4, 0x050607 );
+
+    BOOST_TEST_EQ( load_big_u32( v ), 0x01020304u );
+    BOOST_TEST_EQ( load_little_u24( v + 4 ), 0x050607u );
+    BOOST_TEST_EQ( load_little_u24( v + 4 ), 0x050607u );
+
+    big_uint16_buf_t b( 0x0102 );
+    BOOST_TEST_EQ( b.value(), 0x0102 );
+
+    conversion_counters d = this_thread_conversion_counters() - c1;
+
+    BOOST_TEST_EQ( d.store[ 0 ][ 3 ].calls, expected( 1 ) );
+    BOOST_TEST_EQ( d.store[ 0 ][ 3 ].bytes, expected( 4 ) );
+    BOOST_TEST_EQ( d.store[ 1 ][ 2 ].calls, expected( 1 ) );
+    BOOST_TEST_EQ( d.store[ 0 ][ 1 ].calls, expected( 1 ) );
+
+    BOOST_TEST_EQ( d.load[ 0 ][ 3 ].calls, expected( 1 ) );
+    BOOST_TEST_EQ( d.load[ 1 ][ 2 ].calls, expected( 2 ) );
+    BOOST_TEST_EQ( d.load[ 1 ][ 2 ].bytes, expected( 6 ) );
+    BOOST_TEST_EQ( d.load[ 0 ][ 1 ].calls, expected( 1 ) );
+
+    // loads and stores don't count as endian_reverse calls
+
+    BOOST_TEST_EQ( d.reverse[ 1 ].calls + d.reverse[ 2 ].calls, 0u );
+
+    BOOST_TEST_EQ( d.total().calls, expected( 7 ) );
+    BOOST_TEST_EQ( d.total().bytes, expected( 4 + 3 + 2 + 4 + 6 + 2 ) );
+}
+
+static void test_bulk()
+{
+    conversion_counters c1 = this_thread_conversion_counters();
+
+    std::uint64_t w[ 10 ] = {};
+    unsigned char v[ 80 ];
+
+    endian_store_n<std::uint64_t, order::big>( w, 10, v );
+    endian_load_n<std::uint64_t, order::little>( v, 10, w );
+    endian_reverse_inplace_n( w, 5 );
+
+    std::uint16_t h[ 3 ] = {};
+    endian_reverse_inplace_n( h, 3 );
+
+    conversion_counters d = this_thread_conversion_counters() - c1;
+
+    BOOST_TEST_EQ( d.bulk[ 3 ].calls, expected( 3 ) );
+    BOOST_TEST_EQ( d.bulk[ 3 ].bytes, expected( 200 ) );
+    BOOST_TEST_EQ( d.bulk[ 1 ].calls, expected( 1 ) );
+    BOOST_TEST_EQ( d.bulk[ 1 ].bytes, expected( 6 ) );
+
+    BOOST_TEST_EQ( d.total().calls, expected( 4 ) );
+}
+
+static void test_kernels()
+{
+    conversion_counters c1 = this_thread_conversion_counters();
+
+    std::uint32_t w[ 4 ] = {};
+    unsigned char v[ 24 ] = {};
+    unsigned char u[ 24 ];
+
+    endian_store_delta_n<std::uint32_t, order::big>( w, 4, 0, v );
+    endian_load_delta_n<std::uint32_t, order::big>( v, 4, 0, w );
+    endian_store_offset_n<std::uint32_t, order::little>( w, 4, 0, v );
+    endian_load_offset_n<std::uint32_t, order::little>( v, 4, 0, w );
+
+    typedef record_layout<4, 2, 2, 8, 8> layout;
+
+    endian_reverse_records_n<layout>( v, 1 );
+    endian_convert_records_n<layout, order::big, order::little>( u, v, 1 );
+    endian_convert_records_n<layout>( u, v, 1, order::big, order::native );
+
+    byte_shuffle_n<2, order::big>( v, 12, u );
+    byte_unshuffle_n<2, order::big>( u, 12, v );
+
+    float f[ 8 ] = {};
+
+    pcm_to_float_n<order::little, 3>( v, 8, f );
+    float_to_pcm_n<order::little, 3>( f, 8, v );
+    float_to_pcm_n<order::big, 2>( f, 8, v );
+
+    conversion_counters d = this_thread_conversion_counters() - c1;
+
+    BOOST_TEST_EQ( d.bulk[ 2 ].calls, expected( 6 ) );
+    BOOST_TEST_EQ( d.bulk[ 2 ].bytes, expected( 4 * 16 + 2 * 24 ) );
+    BOOST_TEST_EQ( d.bulk[ 4 ].calls, expected( 3 ) );
+    BOOST_TEST_EQ( d.bulk[ 4 ].bytes, expected( 72 ) );
+    BOOST_TEST_EQ( d.bulk[ 1 ].calls, expected( 3 ) );
+    BOOST_TEST_EQ( d.bulk[ 1 ].bytes, expected( 2 * 24 + 16 ) );
+
+    // the elements of a call are not counted again
+
+    BOOST_TEST_EQ( d.total().calls, expected( 12 ) );
+}
+
+static void worker()
+{
+    unsigned char v[ 4 ];
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        store_little_u32( v, static_cast<std::uint32_t>( i ) );
+    }
+}
+
+static void test_threads()
+{
+    conversion_counters c1 = conversion_counters_snapshot();
+
+    std::thread t1( worker );
+    std::thread t2( worker );
+
+    t1.join();
+    t2.join();
+
+    worker();
+
+    conversion_counters d = conversion_counters_snapshot() - c1;
+
+    // the exited threads are included
+
+    BOOST_TEST_EQ( d.store[ 1 ][ 3 ].calls, expected( 3000 ) );
+    BOOST_TEST_EQ( d.store[ 1 ][ 3 ].bytes, expected( 12000 ) );
+
+    BOOST_TEST_EQ( this_thread_conversion_counters().store[ 1 ][ 3 ].calls, expected( 1000 ) );
+}
+
+int main()
+{
+    test_reverse();
+    test_load_store();
+    test_bulk();
+    test_kernels();
+    test_threads();
+
+    return boost::report_errors();
+}
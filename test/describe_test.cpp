@@ -0,0 +1,226 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/describe/class.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_DESCRIBE_CXX14)
+
+BOOST_PRAGMA_MESSAGE( "Skipping test because C++14 is not available" )
+int main() {}
+
+#else
+
+#include <boost/endian/describe.hpp>
+#include <boost/endian/counters.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+
+namespace app
+{
+
+struct header
+{
+    std::uint16_t type;
+    std::uint32_t length;
+};
+
+BOOST_DESCRIBE_STRUCT( header, (), (type, length) )
+
+class record: public header
+{
+private:
+
+    std::int64_t id_;
+
+public:
+
+    std::int16_t values[ 2 ];
+    header inner;
+    double weight;
+    unsigned char tag;
+
+    std::int64_t id() const { return id_; }
+    void set_id( std::int64_t id ) { id_ = id; }
+
+    BOOST_DESCRIBE_CLASS( record, (header), (values, inner, weight, tag), (), (id_) )
+};
+
+// protected and private bases are reversed too
+
+class framed: protected header
+{
+public:
+
+    std::uint32_t crc;
+
+    std::uint32_t size() const { return length; }
+    void set_size( std::uint32_t n ) { length = n; }
+
+    BOOST_DESCRIBE_CLASS( framed, (header), (crc), (), () )
+};
+
+class sealed: private header
+{
+public:
+
+    std::uint32_t size() const { return length; }
+    void set_size( std::uint32_t n ) { length = n; }
+
+    BOOST_DESCRIBE_CLASS( sealed, (header), (), (), () )
+};
+
+// adjacent members of the same size are reversed together: a to d, then
+// e and f, then h, as g is a single byte and is followed by padding
+
+struct sample
+{
+    std::uint32_t a, b, c, d;
+    std::uint16_t e[ 3 ];
+    std::int16_t f;
+    unsigned char g;
+    std::uint64_t h;
+};
+
+BOOST_DESCRIBE_STRUCT( sample, (), (a, b, c, d, e, f, g, h) )
+
+// not described; uses the user-provided endian_reverse
+
+struct opaque
+{
+    std::uint32_t v;
+};
+
+inline opaque endian_reverse( opaque x ) BOOST_NOEXCEPT
+{
+    opaque r = { boost::endian::endian_reverse( x.v ) };
+    return r;
+}
+
+struct holder
+{
+    opaque o;
+    std::uint16_t w;
+};
+
+BOOST_DESCRIBE_STRUCT( holder, (), (o, w) )
+
+} // namespace app
+
+int main()
+{
+    using namespace boost::endian;
+
+    {
+        app::header h = { 0x0102, 0x01020304 };
+
+        endian_reverse_inplace( h );
+
+        BOOST_TEST_EQ( h.type, 0x0201 );
+        BOOST_TEST_EQ( h.length, 0x04030201u );
+    }
+
+    {
+        app::record r;
+
+        r.type = 0x0102;
+        r.length = 0x01020304;
+        r.set_id( 0x0102030405060708 );
+        r.values[ 0 ] = 0x0102;
+        r.values[ 1 ] = -2;
+        r.inner.type = 0x0A0B;
+        r.inner.length = 1;
+        r.weight = 1.0;
+        r.tag = 7;
+
+        app::record r2 = r;
+
+        endian_reverse_inplace( r );
+
+        BOOST_TEST_EQ( r.type, 0x0201 );
+        BOOST_TEST_EQ( r.length, 0x04030201u );
+        BOOST_TEST_EQ( r.id(), 0x0807060504030201 );
+        BOOST_TEST_EQ( r.values[ 0 ], 0x0201 );
+        BOOST_TEST_EQ( r.values[ 1 ], -257 );
+        BOOST_TEST_EQ( r.inner.type, 0x0B0A );
+        BOOST_TEST_EQ( r.inner.length, 0x01000000u );
+        BOOST_TEST_EQ( r.tag, 7 );
+
+        conditional_reverse_inplace<order::big, order::little>( r );
+
+        BOOST_TEST_EQ( r.type, r2.type );
+        BOOST_TEST_EQ( r.id(), r2.id() );
+        BOOST_TEST_EQ( r.weight, 1.0 );
+
+        native_to_big_inplace( r );
+        big_to_native_inplace( r );
+
+        BOOST_TEST_EQ( r.length, r2.length );
+        BOOST_TEST_EQ( r.inner.type, r2.inner.type );
+    }
+
+    {
+        app::holder h = { { 0x01020304 }, 0x0102 };
+
+        endian_reverse_inplace( h );
+
+        BOOST_TEST_EQ( h.o.v, 0x04030201u );
+        BOOST_TEST_EQ( h.w, 0x0201 );
+    }
+
+    {
+        app::framed f = app::framed();
+
+        f.set_size( 0x01020304 );
+        f.crc = 0x0A0B0C0D;
+
+        endian_reverse_inplace( f );
+
+        BOOST_TEST_EQ( f.size(), 0x04030201u );
+        BOOST_TEST_EQ( f.crc, 0x0D0C0B0Au );
+
+        app::sealed s = app::sealed();
+
+        s.set_size( 0x01020304 );
+
+        endian_reverse_inplace( s );
+
+        BOOST_TEST_EQ( s.size(), 0x04030201u );
+    }
+
+    {
+        app::sample s = { 0x01020304, 0x05060708, 0x090A0B0C, 0x0D0E0F10, { 0x0102, 0x0304, 0x0506 }, -2, 7, 0x0102030405060708 };
+
+        conversion_counters c1 = this_thread_conversion_counters();
+
+        endian_reverse_inplace( s );
+
+        conversion_counters c2 = this_thread_conversion_counters() - c1;
+
+        BOOST_TEST_EQ( s.a, 0x04030201u );
+        BOOST_TEST_EQ( s.b, 0x08070605u );
+        BOOST_TEST_EQ( s.c, 0x0C0B0A09u );
+        BOOST_TEST_EQ( s.d, 0x100F0E0Du );
+        BOOST_TEST_EQ( s.e[ 0 ], 0x0201 );
+        BOOST_TEST_EQ( s.e[ 2 ], 0x0605 );
+        BOOST_TEST_EQ( s.f, -257 );
+        BOOST_TEST_EQ( s.g, 7 );
+        BOOST_TEST_EQ( s.h, 0x0807060504030201u );
+
+        if( conversion_counters_enabled )
+        {
+            BOOST_TEST_EQ( c2.bulk[ 1 ].calls, 1u );
+            BOOST_TEST_EQ( c2.bulk[ 1 ].bytes, 8u );
+            BOOST_TEST_EQ( c2.bulk[ 2 ].calls, 1u );
+            BOOST_TEST_EQ( c2.bulk[ 2 ].bytes, 16u );
+            BOOST_TEST_EQ( c2.bulk[ 3 ].calls, 1u );
+            BOOST_TEST_EQ( c2.reverse[ 2 ].calls, 0u );
+        }
+    }
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+// all sizes up to several 64-bit words plus a tail, at all offsets
+// within a word
+
+template<class T> static void test()
+{
+    std::size_t const M = 40;
+
+    T v[ M ];
+
+    for( std::size_t i = 0; i < M; ++i )
+    {
+        v[ i ] = static_cast<T>( 0x0102030405060708ULL * ( i + 1 ) + 0x1122334455667788ULL );
+    }
+
+    for( std::size_t n = 0; n <= M; ++n )
+    {
+        for( std::size_t offset = 0; offset < 8; ++offset )
+        {
+            unsigned char buffer[ M * sizeof(T) + 8 ];
+            unsigned char * p = buffer + offset;
+
+            endian_store_n<T, order::big>( v, n, p );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( (endian_load<T, sizeof(T), order::big>( p + i * sizeof(T) )), v[ i ] );
+            }
+
+            T w[ M ] = {};
+
+            endian_load_n<T, order::big>( p, n, w );
+            BOOST_TEST( std::memcmp( v, w, n * sizeof(T) ) == 0 );
+
+            endian_load_n<T, order::little>( p, n, w );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( w[ i ], (conditional_reverse<order::big, order::little>( v[ i ] )) );
+            }
+
+            endian_reverse_inplace_n( w, n );
+            BOOST_TEST( std::memcmp( v, w, n * sizeof(T) ) == 0 );
+
+            conditional_reverse_inplace_n<order::big, order::little>( w, n );
+            conditional_reverse_inplace_n<order::little, order::little>( w, n );
+            conditional_reverse_inplace_n( w, n, order::big, order::big );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( w[ i ], endian_reverse( v[ i ] ) );
+            }
+
+            conditional_reverse_inplace_n( w, n, order::little, order::big );
+            BOOST_TEST( std::memcmp( v, w, n * sizeof(T) ) == 0 );
+
+            // the element after the range is untouched
+
+            BOOST_TEST_EQ( w[ n < M? n: 0 ], n < M? T(): v[ 0 ] );
+        }
+    }
+}
+
+int main()
+{
+    test<std::uint8_t>();
+    test<std::uint16_t>();
+    test<std::int16_t>();
+    test<std::uint32_t>();
+    test<std::int32_t>();
+    test<std::uint64_t>();
+
+    return boost::report_errors();
+}
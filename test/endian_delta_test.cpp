@@ -0,0 +1,118 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+// a - b modulo 2^(8*sizeof(T)), computed in the unsigned type like the
+// kernels do, since the signed subtraction can overflow
+
+template<class T> static T wrapping_sub( T a, T b )
+{
+    typedef typename std::make_unsigned<T>::type U;
+    return static_cast<T>( static_cast<U>( static_cast<U>( a ) - static_cast<U>( b ) ) );
+}
+
+template<class T, order Order> static void test_delta()
+{
+    std::size_t const n = 67;
+
+    T v[ n ];
+
+    std::uint64_t x = 0x9E3779B97F4A7C15ULL;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        // mostly increasing, with some decreases and wraparound
+
+        v[ i ] = static_cast<T>( ( i == 0? 0: v[ i - 1 ] ) + static_cast<T>( x >> 56 ) - ( i % 7 == 0? 100: 0 ) );
+    }
+
+    v[ n - 1 ] = std::numeric_limits<T>::max();
+
+    T const base = wrapping_sub( v[ 0 ], static_cast<T>( 3 ) );
+
+    unsigned char p[ n * sizeof(T) ];
+
+    endian_store_delta_n<T, Order>( v, n, base, p );
+
+    BOOST_TEST_EQ( (endian_load<T, sizeof(T), Order>( p )), 3 );
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        BOOST_TEST_EQ( (endian_load<T, sizeof(T), Order>( p + i * sizeof(T) )), wrapping_sub( v[ i ], v[ i - 1 ] ) );
+    }
+
+    T w[ n ];
+
+    endian_load_delta_n<T, Order>( p, n, base, w );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( w[ i ], v[ i ] );
+    }
+
+    endian_store_offset_n<T, Order>( v, n, base, p );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( (endian_load<T, sizeof(T), Order>( p + i * sizeof(T) )), wrapping_sub( v[ i ], base ) );
+    }
+
+    endian_load_offset_n<T, Order>( p, n, base, w );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( w[ i ], v[ i ] );
+    }
+
+    // empty ranges
+
+    endian_store_delta_n<T, Order>( v, 0, base, p );
+    endian_load_delta_n<T, Order>( p, 0, base, w );
+}
+
+static void test_timestamps()
+{
+    // big-endian 64 bit timestamps as deltas from a block base
+
+    unsigned char const p[] =
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE8,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    };
+
+    std::int64_t t[ 3 ];
+
+    endian_load_delta_n<std::int64_t, order::big>( p, 3, 1700000000000, t );
+
+    BOOST_TEST_EQ( t[ 0 ], 1700000001000 );
+    BOOST_TEST_EQ( t[ 1 ], 1700000002000 );
+    BOOST_TEST_EQ( t[ 2 ], 1700000001999 );
+}
+
+int main()
+{
+    test_delta<std::int8_t, order::big>();
+    test_delta<std::uint16_t, order::big>();
+    test_delta<std::int32_t, order::little>();
+    test_delta<std::uint32_t, order::big>();
+    test_delta<std::int64_t, order::big>();
+    test_delta<std::uint64_t, order::little>();
+    test_delta<std::int64_t, order::native>();
+
+    test_timestamps();
+
+    return boost::report_errors();
+}
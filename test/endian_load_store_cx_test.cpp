@@ -0,0 +1,71 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <boost/config.hpp>
+
+#if !defined(BOOST_ENDIAN_CONSTEXPR_LOAD_STORE)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because BOOST_ENDIAN_CONSTEXPR_LOAD_STORE is not defined")
+
+#else
+
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+#define STATIC_ASSERT(expr) static_assert(expr, #expr)
+
+constexpr unsigned char v[] = { 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8 };
+
+STATIC_ASSERT( load_little_u16( v ) == 0xF2F1 );
+STATIC_ASSERT( load_big_s16( v ) == -3598 );
+
+STATIC_ASSERT( load_little_u24( v ) == 0xF3F2F1 );
+STATIC_ASSERT( load_big_s24( v ) == -920845 );
+
+STATIC_ASSERT( load_little_u32( v ) == 0xF4F3F2F1 );
+STATIC_ASSERT( load_big_u32( v ) == 0xF1F2F3F4 );
+
+STATIC_ASSERT( load_little_s40( v ) == -43135012111 );
+STATIC_ASSERT( load_big_u48( v ) == 0xF1F2F3F4F5F6 );
+STATIC_ASSERT( load_little_s56( v ) == -2261738553347343 );
+
+STATIC_ASSERT( load_little_u64( v ) == 0xF8F7F6F5F4F3F2F1 );
+STATIC_ASSERT( load_big_u64( v ) == 0xF1F2F3F4F5F6F7F8 );
+
+STATIC_ASSERT( (endian_load<std::uint8_t, 1, order::big>( v )) == 0xF1 );
+STATIC_ASSERT( (endian_load<std::int64_t, 2, order::big>( v )) == -3598 );
+
+struct blob
+{
+    unsigned char data[ 16 ];
+};
+
+constexpr blob encode()
+{
+    blob r{};
+
+    store_big_u32( r.data, 0x01020304 );
+    store_little_s24( r.data + 4, -2 );
+    store_big_u56( r.data + 7, 0x0A0B0C0D0E0F10 );
+    endian_store<float, 4, order::big>( r.data + 12, 1.0f );
+
+    return r;
+}
+
+constexpr blob b = encode();
+
+STATIC_ASSERT( b.data[0] == 0x01 && b.data[1] == 0x02 && b.data[2] == 0x03 && b.data[3] == 0x04 );
+STATIC_ASSERT( b.data[4] == 0xFE && b.data[5] == 0xFF && b.data[6] == 0xFF );
+STATIC_ASSERT( b.data[7] == 0x0A && b.data[11] == 0x0E );
+STATIC_ASSERT( b.data[12] == 0x3F && b.data[13] == 0x80 && b.data[14] == 0x00 && b.data[15] == 0x00 );
+
+STATIC_ASSERT( (endian_load<float, 4, order::big>( b.data + 12 )) == 1.0f );
+STATIC_ASSERT( load_little_s24( b.data + 4 ) == -2 );
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/conversion.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_ENDIAN_NO_INTRINSICS) && defined(BOOST_NO_CXX14_CONSTEXPR)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because BOOST_ENDIAN_NO_INTRINSICS and BOOST_NO_CXX14_CONSTEXPR are defined")
+
+#elif !defined(BOOST_ENDIAN_NO_INTRINSICS) && !defined(BOOST_ENDIAN_CONSTEXPR_INTRINSICS) && !defined(BOOST_ENDIAN_CONSTEXPR_FALLBACK)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because endian_reverse is not constexpr on this platform")
+
+#else
+
+#include <cstdint>
+
+BOOST_PRAGMA_MESSAGE("BOOST_ENDIAN_INTRINSIC_MSG: " BOOST_ENDIAN_INTRINSIC_MSG)
+
+using namespace boost::endian;
+
+#define STATIC_ASSERT(expr) static_assert(expr, #expr)
+
+enum class E16: std::int16_t { a = 0x0102, b = 0x0201 };
+
+STATIC_ASSERT( endian_reverse( static_cast<std::int8_t>( -2 ) ) == -2 );
+STATIC_ASSERT( endian_reverse( static_cast<std::int16_t>( 0x0180 ) ) == static_cast<std::int16_t>( 0x8001 ) );
+STATIC_ASSERT( endian_reverse( static_cast<std::int32_t>( 0x01020380 ) ) == static_cast<std::int32_t>( 0x80030201 ) );
+STATIC_ASSERT( endian_reverse( static_cast<std::int64_t>( 0x0102030405060780 ) ) == static_cast<std::int64_t>( 0x8007060504030201 ) );
+
+STATIC_ASSERT( endian_reverse( E16::a ) == E16::b );
+
+STATIC_ASSERT( endian_reverse( endian_reverse( 0x0123456789ABCDEFULL ) ) == 0x0123456789ABCDEFULL );
+
+STATIC_ASSERT( (conditional_reverse<order::big, order::little>( static_cast<std::uint16_t>( 0x0102 ) )) == 0x0201 );
+STATIC_ASSERT( conditional_reverse( static_cast<std::uint32_t>( 0x01020304 ), order::big, order::little ) == 0x04030201 );
+
+#if defined(__SIZEOF_INT128__)
+
+constexpr __uint128_t x128 = static_cast<__uint128_t>( 0x0102030405060708ULL ) << 64 | 0x090A0B0C0D0E0F10ULL;
+constexpr __uint128_t y128 = static_cast<__uint128_t>( 0x100F0E0D0C0B0A09ULL ) << 64 | 0x0807060504030201ULL;
+
+STATIC_ASSERT( endian_reverse( x128 ) == y128 );
+
+#endif
+
+#endif
@@ -0,0 +1,20 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/search.hpp>
+#include <boost/endian/buffers.hpp>
+#include <cstdint>
+
+using namespace boost::endian;
+
+// the elements must be as wide as their value type
+
+typedef endian_buffer<order::big, std::uint32_t, 16> E;
+
+int main()
+{
+    E a[ 4 ];
+    return endian_find( a, a + 4, 1u ) != a + 4;
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/search.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+template<class E> static void test_sorted( std::size_t n, std::size_t stride )
+{
+    typedef typename E::value_type T;
+
+    // even values, with runs of duplicates
+
+    std::vector<T> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<T>( 2 * ( i - i % 3 ) + 10 );
+    }
+
+    std::vector<E> w( v.begin(), v.end() );
+
+    E const * first = w.data();
+    E const * last = first + n;
+
+    endian_sampled_index<E> index( first, last, stride );
+
+    BOOST_TEST_EQ( index.stride(), stride );
+    BOOST_TEST_EQ( index.sample_count(), ( n + stride - 1 ) / stride );
+
+    for( std::size_t k = 0; k < 2 * n + 14; ++k )
+    {
+        T x = static_cast<T>( k );
+
+        std::size_t lb = static_cast<std::size_t>( std::lower_bound( v.begin(), v.end(), x ) - v.begin() );
+        std::size_t c = static_cast<std::size_t>( std::count( v.begin(), v.end(), x ) );
+        std::size_t f = static_cast<std::size_t>( std::find( v.begin(), v.end(), x ) - v.begin() );
+
+        BOOST_TEST_EQ( endian_lower_bound( first, last, x ) - first, static_cast<std::ptrdiff_t>( lb ) );
+        BOOST_TEST_EQ( index.lower_bound( x ) - first, static_cast<std::ptrdiff_t>( lb ) );
+
+        BOOST_TEST_EQ( endian_count( first, last, x ), c );
+        BOOST_TEST_EQ( endian_find( first, last, x ) - first, static_cast<std::ptrdiff_t>( f ) );
+
+        BOOST_TEST_EQ( index.find( x ) - first, static_cast<std::ptrdiff_t>( c == 0? n: lb ) );
+    }
+}
+
+template<class E> static void test_sorted()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 31, 32, 33, 64, 100, 1000 };
+    std::size_t const strides[] = { 1, 7, 64 };
+
+    for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+    {
+        // the values must not wrap around
+        if( 2 * sizes[ i ] + 14 > static_cast<std::size_t>( std::numeric_limits<typename E::value_type>::max() ) ) continue;
+
+        for( std::size_t j = 0; j < sizeof( strides ) / sizeof( strides[0] ); ++j )
+        {
+            test_sorted<E>( sizes[ i ], strides[ j ] );
+        }
+    }
+}
+
+template<class E> static void test_signed()
+{
+    typedef typename E::value_type T;
+
+    std::vector<T> v;
+
+    for( int i = -100; i < 100; i += 3 )
+    {
+        v.push_back( static_cast<T>( i ) );
+    }
+
+    std::vector<E> w( v.begin(), v.end() );
+
+    E const * first = w.data();
+    E const * last = first + w.size();
+
+    endian_sampled_index<E> index( first, last, 8 );
+
+    for( int i = -110; i < 110; ++i )
+    {
+        T x = static_cast<T>( i );
+
+        std::ptrdiff_t lb = std::lower_bound( v.begin(), v.end(), x ) - v.begin();
+
+        BOOST_TEST_EQ( endian_lower_bound( first, last, x ) - first, lb );
+        BOOST_TEST_EQ( index.lower_bound( x ) - first, lb );
+    }
+}
+
+static void test_unsorted()
+{
+    big_uint32_buf_t w[ 100 ];
+
+    for( int i = 0; i < 100; ++i )
+    {
+        w[ i ] = static_cast<std::uint32_t>( ( i * 37 ) % 11 );
+    }
+
+    BOOST_TEST_EQ( endian_find( w, w + 100, 5u ) - w, 4 );
+    BOOST_TEST_EQ( endian_find( w, w + 100, 11u ) - w, 100 );
+    BOOST_TEST_EQ( endian_count( w, w + 100, 0u ), 10u );
+    BOOST_TEST_EQ( endian_count( w, w + 100, 10u ), 9u );
+
+    // a match only in the last element of a block, and only in the tail
+
+    big_uint64_buf_t u[ 70 ] = {};
+
+    u[ 31 ] = 0x0102030405060708ULL;
+    u[ 69 ] = 0x0807060504030201ULL;
+
+    BOOST_TEST_EQ( endian_find( u, u + 70, 0x0102030405060708ULL ) - u, 31 );
+    BOOST_TEST_EQ( endian_find( u, u + 70, 0x0807060504030201ULL ) - u, 69 );
+    BOOST_TEST_EQ( endian_find( u, u + 69, 0x0807060504030201ULL ) - u, 69 );
+}
+
+int main()
+{
+    test_sorted<big_uint32_buf_t>();
+    test_sorted<big_uint64_buf_t>();
+    test_sorted<little_uint32_buf_t>();
+    test_sorted<big_uint16_buf_t>();
+    test_sorted<big_uint8_buf_t>();
+    test_sorted<big_uint32_buf_at>();
+    test_sorted<big_uint64_t>();
+    test_sorted<little_uint16_at>();
+
+    test_signed<big_int32_buf_t>();
+    test_signed<little_int64_buf_t>();
+    test_signed<big_int16_t>();
+
+    test_unsorted();
+
+    return boost::report_errors();
+}
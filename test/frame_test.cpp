@@ -0,0 +1,199 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/frame.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+struct sample
+{
+    std::uint32_t id;
+    std::int16_t a;
+    std::uint16_t b;
+    double value;
+};
+
+typedef record_layout<4, 2, 2, 8> layout;
+
+std::size_t const n = 19;
+std::uint16_t const schema = 0x0107;
+
+BOOST_CONSTEXPR_OR_CONST order foreign = order::native == order::big? order::little: order::big;
+
+static void make_samples( sample * s )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        s[ i ].id = static_cast<std::uint32_t>( 0x01020304 * i + 5 );
+        s[ i ].a = static_cast<std::int16_t>( -static_cast<int>( i ) * 300 );
+        s[ i ].b = static_cast<std::uint16_t>( 0xA0B0 + i );
+        s[ i ].value = i * 1.25 - 7;
+    }
+}
+
+static void test_samples( sample const * s, sample const * t )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( s[ i ].id, t[ i ].id );
+        BOOST_TEST_EQ( s[ i ].a, t[ i ].a );
+        BOOST_TEST_EQ( s[ i ].b, t[ i ].b );
+        BOOST_TEST_EQ( s[ i ].value, t[ i ].value );
+    }
+}
+
+// a frame as written by a producer of the other byte order
+
+static void make_foreign_frame( unsigned char * p, sample const * s )
+{
+    endian_store<std::uint16_t, 2, foreign>( p, 0xFEFF );
+    endian_store<std::uint16_t, 2, foreign>( p + 2, schema );
+    endian_store<std::uint32_t, 4, foreign>( p + 4, static_cast<std::uint32_t>( n * layout::size ) );
+
+    endian_convert_records_n<layout, order::native, foreign>( p + frame_header_size, reinterpret_cast<unsigned char const*>( s ), n );
+}
+
+static void test_header()
+{
+    unsigned char p[ frame_header_size + 4 ];
+
+    store_frame_header( p, 0x1234, 4 );
+
+    if( order::native == order::little )
+    {
+        unsigned char const expected[] = { 0xFF, 0xFE, 0x34, 0x12, 0x04, 0, 0, 0 };
+        BOOST_TEST_EQ( std::memcmp( p, expected, sizeof(expected) ), 0 );
+    }
+    else
+    {
+        unsigned char const expected[] = { 0xFE, 0xFF, 0x12, 0x34, 0, 0, 0, 0x04 };
+        BOOST_TEST_EQ( std::memcmp( p, expected, sizeof(expected) ), 0 );
+    }
+
+    frame_header h = {};
+
+    BOOST_TEST( load_frame_header( p, sizeof(p), h ) );
+    BOOST_TEST( h.byte_order == order::native );
+    BOOST_TEST_EQ( h.schema, 0x1234 );
+    BOOST_TEST_EQ( h.size, 4u );
+
+    // the payload does not fit
+    BOOST_TEST( !load_frame_header( p, sizeof(p) - 1, h ) );
+
+    // too short for a header
+    BOOST_TEST( !load_frame_header( p, frame_header_size - 1, h ) );
+
+    // no byte order mark
+    p[ 0 ] = 0xFE; p[ 1 ] = 0xFE;
+    BOOST_TEST( !load_frame_header( p, sizeof(p), h ) );
+}
+
+static void test_native()
+{
+    sample s[ n ];
+    make_samples( s );
+
+    unsigned char p[ record_frame_size<layout>( n ) ];
+    BOOST_TEST_EQ( sizeof(p), frame_header_size + n * 16 );
+
+    store_record_frame<layout>( p, s, n, schema );
+
+    // the payload is the records as they are in memory
+    BOOST_TEST_EQ( std::memcmp( p + frame_header_size, s, sizeof(s) ), 0 );
+
+    frame_header h = {};
+
+    BOOST_TEST( load_record_frame<layout>( p, sizeof(p), h ) );
+    BOOST_TEST( h.byte_order == order::native );
+    BOOST_TEST_EQ( h.schema, schema );
+    BOOST_TEST_EQ( h.size, n * 16 );
+
+    BOOST_TEST_EQ( std::memcmp( p + frame_header_size, s, sizeof(s) ), 0 );
+
+    sample t[ n ];
+
+    BOOST_TEST( load_record_frame<layout>( static_cast<unsigned char const*>( p ), sizeof(p), t, n, h ) );
+    test_samples( s, t );
+}
+
+static void test_foreign()
+{
+    sample s[ n ];
+    make_samples( s );
+
+    unsigned char p[ record_frame_size<layout>( n ) ];
+    make_foreign_frame( p, s );
+
+    frame_header h = {};
+    sample t[ n ];
+
+    // copying
+
+    BOOST_TEST( !load_record_frame<layout>( static_cast<unsigned char const*>( p ), sizeof(p), t, n - 1, h ) );
+
+    BOOST_TEST( load_record_frame<layout>( static_cast<unsigned char const*>( p ), sizeof(p), t, n, h ) );
+    BOOST_TEST( h.byte_order == foreign );
+    BOOST_TEST_EQ( h.schema, schema );
+    BOOST_TEST_EQ( h.size, n * 16 );
+
+    test_samples( s, t );
+
+    // in place
+
+    BOOST_TEST( load_record_frame<layout>( p, sizeof(p), h ) );
+    BOOST_TEST( h.byte_order == foreign );
+
+    std::memcpy( t, p + frame_header_size, sizeof(t) );
+    test_samples( s, t );
+
+    // the frame is now in the native order
+
+    BOOST_TEST( load_record_frame<layout>( p, sizeof(p), h ) );
+    BOOST_TEST( h.byte_order == order::native );
+    BOOST_TEST_EQ( h.schema, schema );
+
+    std::memcpy( t, p + frame_header_size, sizeof(t) );
+    test_samples( s, t );
+}
+
+static void test_invalid()
+{
+    sample s[ n ];
+    make_samples( s );
+
+    unsigned char p[ record_frame_size<layout>( n ) ];
+    make_foreign_frame( p, s );
+
+    unsigned char q[ sizeof(p) ];
+    std::memcpy( q, p, sizeof(p) );
+
+    frame_header h = {};
+
+    // truncated
+    BOOST_TEST( !load_record_frame<layout>( p, sizeof(p) - 1, h ) );
+
+    // not a whole number of records
+    endian_store<std::uint32_t, 4, foreign>( p + 4, static_cast<std::uint32_t>( n * layout::size - 1 ) );
+    BOOST_TEST( !load_record_frame<layout>( p, sizeof(p), h ) );
+    endian_store<std::uint32_t, 4, foreign>( p + 4, static_cast<std::uint32_t>( n * layout::size ) );
+
+    // the frame is unchanged
+    BOOST_TEST_EQ( std::memcmp( p, q, sizeof(p) ), 0 );
+}
+
+int main()
+{
+    test_header();
+    test_native();
+    test_foreign();
+    test_invalid();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,213 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/hash_table.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+struct entry
+{
+    big_uint32_buf_t offset;
+    little_int16_buf_t delta;
+};
+
+typedef endian_hash_table_builder<big_uint32_buf_t, entry> builder;
+typedef endian_hash_table_view<big_uint32_buf_t, entry> view;
+
+static std::uint32_t key( std::size_t i )
+{
+    return static_cast<std::uint32_t>( i * 0x9E3779B9u );
+}
+
+static void build( builder & b, std::size_t n )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        entry e;
+
+        e.offset = static_cast<std::uint32_t>( i * 16 );
+        e.delta = static_cast<std::int16_t>( -static_cast<int>( i ) );
+
+        BOOST_TEST( b.insert( big_uint32_buf_t( key( i ) ), e ) );
+    }
+}
+
+static void test_lookup( view const & v, std::size_t n )
+{
+    BOOST_TEST( v.valid() );
+    BOOST_TEST_EQ( v.size(), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        entry const * e = v.find( big_uint32_buf_t( key( i ) ) );
+
+        if( BOOST_TEST( e != 0 ) )
+        {
+            BOOST_TEST_EQ( e->offset.value(), i * 16 );
+            BOOST_TEST_EQ( e->delta.value(), -static_cast<int>( i ) );
+        }
+    }
+
+    for( std::size_t i = n; i < 2 * n; ++i )
+    {
+        BOOST_TEST( !v.contains( big_uint32_buf_t( key( i ) ) ) );
+    }
+}
+
+static void test_builder()
+{
+    std::size_t const n = 1000;
+
+    builder b;
+    BOOST_TEST_EQ( b.bucket_count(), 8u );
+
+    build( b, n );
+
+    BOOST_TEST_EQ( b.size(), n );
+    BOOST_TEST_EQ( b.bucket_count(), 2048u );
+    BOOST_TEST_EQ( b.storage_size(), 24 + 2048 * ( 1 + 4 + 6 ) );
+
+    entry e = {};
+    BOOST_TEST( !b.insert( big_uint32_buf_t( key( 7 ) ), e ) );
+    BOOST_TEST_EQ( b.size(), n );
+
+    view v( b.data(), b.storage_size() );
+    test_lookup( v, n );
+
+    // reserved
+
+    builder b2( n );
+    BOOST_TEST_EQ( b2.bucket_count(), 2048u );
+
+    build( b2, n );
+    BOOST_TEST_EQ( b2.bucket_count(), 2048u );
+
+    test_lookup( view( b2.data(), b2.storage_size() ), n );
+}
+
+static void test_relocated()
+{
+    std::size_t const n = 300;
+
+    builder b;
+    build( b, n );
+
+    std::vector<unsigned char> w( b.storage_size() + 1 );
+    std::memcpy( &w[ 1 ], b.data(), b.storage_size() );
+
+    test_lookup( view( &w[ 1 ], b.storage_size() ), n );
+}
+
+// the table is the same on all hosts
+
+static void test_format()
+{
+    endian_hash_table_builder<little_uint16_buf_t, big_uint16_buf_t> b;
+
+    for( std::uint16_t i = 1; i <= 5; ++i )
+    {
+        b.insert( little_uint16_buf_t( static_cast<std::uint16_t>( i * 1000 ) ), big_uint16_buf_t( i ) );
+    }
+
+    unsigned char const * p = b.data();
+
+    unsigned char const header[] = { 8, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0 };
+    BOOST_TEST_EQ( std::memcmp( p, header, sizeof(header) ), 0 );
+
+    std::uint32_t h = 2166136261u;
+
+    for( std::size_t i = 0; i < b.storage_size(); ++i )
+    {
+        h = ( h ^ p[ i ] ) * 16777619u;
+    }
+
+    BOOST_TEST_EQ( h, 0xCB9D1003u );
+}
+
+static void test_invalid()
+{
+    builder b;
+    build( b, 10 );
+
+    std::vector<unsigned char> w( b.data(), b.data() + b.storage_size() );
+
+    BOOST_TEST( view( &w[ 0 ], w.size() ).valid() );
+
+    // truncated
+    BOOST_TEST( !view( &w[ 0 ], w.size() - 1 ).valid() );
+    BOOST_TEST( !view( &w[ 0 ], 23 ).valid() );
+
+    // other key or value types
+    BOOST_TEST( !( endian_hash_table_view<big_uint64_buf_t, entry>( &w[ 0 ], w.size() ).valid() ) );
+    BOOST_TEST( !( endian_hash_table_view<big_uint32_buf_t, big_uint32_buf_t>( &w[ 0 ], w.size() ).valid() ) );
+
+    // bucket count not a power of two
+    w[ 0 ] = 15;
+    BOOST_TEST( !view( &w[ 0 ], w.size() ).valid() );
+    w[ 0 ] = 16;
+
+    // full
+    w[ 8 ] = 16;
+    BOOST_TEST( !view( &w[ 0 ], w.size() ).valid() );
+    w[ 8 ] = 10;
+
+    view v( &w[ 0 ], w.size() );
+    BOOST_TEST( v.valid() );
+
+    // an invalid view is empty
+
+    view v2;
+
+    BOOST_TEST( !v2.valid() );
+    BOOST_TEST_EQ( v2.size(), 0u );
+    BOOST_TEST( v2.find( big_uint32_buf_t( key( 1 ) ) ) == 0 );
+
+    // a table without empty buckets does not loop
+
+    std::memset( &w[ 24 ], 0x80, 16 );
+    BOOST_TEST( !view( &w[ 0 ], w.size() ).contains( big_uint32_buf_t( 12345 ) ) );
+}
+
+static void test_arithmetic_keys()
+{
+    endian_hash_table_builder<little_int64_t, little_uint8_buf_t> b;
+
+    for( int i = -100; i < 100; ++i )
+    {
+        b.insert( little_int64_t( i ), little_uint8_buf_t( static_cast<std::uint8_t>( i + 100 ) ) );
+    }
+
+    endian_hash_table_view<little_int64_t, little_uint8_buf_t> v( b.data(), b.storage_size() );
+
+    BOOST_TEST_EQ( v.size(), 200u );
+
+    for( int i = -100; i < 100; ++i )
+    {
+        little_uint8_buf_t const * r = v.find( little_int64_t( i ) );
+
+        if( BOOST_TEST( r != 0 ) )
+        {
+            BOOST_TEST_EQ( r->value(), i + 100 );
+        }
+    }
+}
+
+int main()
+{
+    test_builder();
+    test_relocated();
+    test_format();
+    test_invalid();
+    test_arithmetic_keys();
+
+    return boost::report_errors();
+}
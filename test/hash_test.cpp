@@ -0,0 +1,101 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/hash.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_map>
+#include <functional>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+static std::size_t expected( std::uint64_t x, std::size_t n )
+{
+    // endian_hash_mix of the bytes read as a little-endian integer, plus n
+
+    x += n;
+
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+
+    return static_cast<std::size_t>( x );
+}
+
+template<class E> static void test_hash( E const & x, std::uint64_t le, std::size_t n )
+{
+    BOOST_TEST_EQ( hash_value( x ), expected( le, n ) );
+    BOOST_TEST_EQ( std::hash<E>()( x ), expected( le, n ) );
+    BOOST_TEST_EQ( boost::hash<E>()( x ), expected( le, n ) );
+}
+
+static void test_values()
+{
+    // the results depend only on the stored bytes
+
+    test_hash( big_uint32_buf_t( 0x01020304 ), 0x04030201, 4 );
+    test_hash( little_uint32_buf_t( 0x04030201 ), 0x04030201, 4 );
+    test_hash( big_uint32_buf_at( 0x01020304 ), 0x04030201, 4 );
+    test_hash( big_uint32_t( 0x01020304 ), 0x04030201, 4 );
+    test_hash( little_uint32_at( 0x04030201 ), 0x04030201, 4 );
+
+    test_hash( big_uint64_buf_t( 0x0102030405060708 ), 0x0807060504030201, 8 );
+    test_hash( little_int16_buf_t( -2 ), 0xFFFE, 2 );
+    test_hash( big_int24_t( -2 ), 0xFEFFFF, 3 );
+    test_hash( big_uint8_buf_t( 7 ), 7, 1 );
+
+    BOOST_TEST_NE( hash_value( big_uint32_buf_t( 1 ) ), hash_value( big_uint32_buf_t( 2 ) ) );
+    BOOST_TEST_NE( hash_value( big_uint32_buf_t( 1 ) ), hash_value( big_uint64_buf_t( 1 ) ) );
+}
+
+static void test_unordered_map()
+{
+    std::unordered_map<std::uint64_t, int> m1;
+    std::unordered_map<big_uint64_t, int> m2;
+
+    for( int i = 0; i < 100; ++i )
+    {
+        m1[ i * 1000003u ] = i;
+        m2[ big_uint64_t( i * 1000003u ) ] = i;
+    }
+
+    BOOST_TEST_EQ( m2.size(), 100u );
+    BOOST_TEST_EQ( m2[ big_uint64_t( 17 * 1000003u ) ], 17 );
+}
+
+static void test_bulk()
+{
+    little_uint32_buf_t v[ 17 ];
+    std::size_t h[ 17 ];
+
+    for( int i = 0; i < 17; ++i )
+    {
+        v[ i ] = static_cast<std::uint32_t>( i * 0x01010101 );
+    }
+
+    endian_hash_n( v, 17, h );
+
+    for( int i = 0; i < 17; ++i )
+    {
+        BOOST_TEST_EQ( h[ i ], expected( static_cast<std::uint32_t>( i * 0x01010101 ), 4 ) );
+    }
+}
+
+int main()
+{
+    BOOST_TEST( (std::is_default_constructible< std::hash<big_uint32_buf_t> >::value) );
+    BOOST_TEST( !(std::is_default_constructible< std::hash<big_float32_buf_t> >::value) );
+
+    test_values();
+    test_unordered_map();
+    test_bulk();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Measures net::internet_checksum against a loop calling load_big_u16
+// for each 16-bit word, for several buffer sizes.
+
+#include <boost/endian/net/checksum.hpp>
+#include <boost/endian/conversion.hpp>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+static std::uint16_t checksum_scalar( unsigned char const * p, std::size_t n, std::uint16_t )
+{
+    std::uint32_t s = 0;
+
+    for( std::size_t i = 0; i + 1 < n; i += 2 )
+    {
+        s += load_big_u16( p + i );
+    }
+
+    if( n % 2 ) s += p[ n - 1 ] << 8;
+
+    while( s >> 16 ) s = ( s & 0xFFFF ) + ( s >> 16 );
+
+    return static_cast<std::uint16_t>( ~s );
+}
+
+typedef std::uint16_t (*checksum_fn)( unsigned char const *, std::size_t, std::uint16_t );
+
+static std::uint64_t run( char const * name, checksum_fn f, std::vector<unsigned char> const & v, std::size_t size )
+{
+    std::size_t rounds = ( std::size_t( 1 ) << 30 ) / size;
+    std::size_t m = v.size() - size;
+
+    std::uint64_t r = 0;
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    for( std::size_t k = 0; k < rounds; ++k )
+    {
+        // vary the starting offset, so that misaligned buffers are included
+
+        r += f( &v[ 0 ] + ( k * 61 ) % m, size, 0 );
+    }
+
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    double s = std::chrono::duration<double>( t2 - t1 ).count();
+
+    std::cout << "  " << name << ": " << static_cast<double>( rounds * size ) / s / 1e9 << " GB/s\n";
+
+    return r;
+}
+
+int main()
+{
+    std::vector<unsigned char> v( 65536 + 4096 );
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    std::size_t const sizes[] = { 20, 64, 576, 1500, 9000, 65535 };
+
+    int r = 0;
+
+    for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+    {
+        std::cout << sizes[ i ] << " bytes:\n";
+
+        std::uint64_t c1 = run( "load_big_u16", checksum_scalar, v, sizes[ i ] );
+        std::uint64_t c2 = run( "internet_checksum", net::internet_checksum, v, sizes[ i ] );
+
+        if( c1 != c2 )
+        {
+            std::cerr << "checksum mismatch\n";
+            r = 1;
+        }
+    }
+
+    return r;
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net/checksum.hpp>
+#include <boost/endian/net/ipv4.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+static std::uint16_t reference_sum( unsigned char const * p, std::size_t n )
+{
+    std::uint32_t s = 0;
+
+    for( std::size_t i = 0; i + 1 < n; i += 2 )
+    {
+        s += load_big_u16( p + i );
+    }
+
+    if( n % 2 ) s += p[ n - 1 ] << 8;
+
+    while( s >> 16 ) s = ( s & 0xFFFF ) + ( s >> 16 );
+
+    return static_cast<std::uint16_t>( s );
+}
+
+static void test_rfc1071()
+{
+    // RFC 1071, section 3
+
+    unsigned char const v[] = { 0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7 };
+
+    BOOST_TEST_EQ( net::ones_complement_sum( v, sizeof( v ) ), 0xDDF2u );
+    BOOST_TEST_EQ( net::internet_checksum( v, sizeof( v ) ), 0x220Du );
+
+    BOOST_TEST_EQ( net::ones_complement_sum( v, 0 ), 0u );
+    BOOST_TEST_EQ( net::ones_complement_sum( v, 1 ), 0u );
+    BOOST_TEST_EQ( net::ones_complement_sum( v + 2, 1 ), 0xF200u );
+    BOOST_TEST_EQ( net::ones_complement_sum( v + 2, 3 ), 0xF203u + 0xF400u - 0xFFFFu );
+
+    // continuing a sum
+
+    BOOST_TEST_EQ( net::ones_complement_sum( v + 4, 4, net::ones_complement_sum( v, 4 ) ), 0xDDF2u );
+}
+
+static void test_ipv4()
+{
+    unsigned char h[] =
+    {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11, 0xB8, 0x61,
+        0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0xC7,
+    };
+
+    BOOST_TEST_EQ( net::internet_checksum( h, sizeof( h ) ), 0u );
+
+    net::ipv4_header * ip = net::header_cast<net::ipv4_header>( h );
+
+    std::uint16_t hc = ip->header_checksum.value();
+
+    ip->header_checksum = 0;
+    BOOST_TEST_EQ( net::internet_checksum( h, sizeof( h ) ), 0xB861u );
+
+    // RFC 1624 incremental updates
+
+    ip->header_checksum = hc;
+
+    ip->ttl = 63;
+    ip->header_checksum = net::internet_checksum_update( ip->header_checksum.value(), 0x4011, 0x3F11 );
+
+    BOOST_TEST_EQ( net::internet_checksum( h, sizeof( h ) ), 0u );
+
+    std::uint32_t old_address = ip->destination.value();
+
+    ip->destination = 0x0A000001;
+    ip->header_checksum = net::internet_checksum_update32( ip->header_checksum.value(), old_address, 0x0A000001 );
+
+    BOOST_TEST_EQ( net::internet_checksum( h, sizeof( h ) ), 0u );
+}
+
+static void test_lengths()
+{
+    unsigned char v[ 301 ];
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < sizeof( v ); ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    for( std::size_t k = 0; k < 4; ++k )
+    {
+        for( std::size_t n = 0; n + k <= sizeof( v ); ++n )
+        {
+            BOOST_TEST_EQ( net::ones_complement_sum( v + k, n ), reference_sum( v + k, n ) );
+        }
+    }
+
+    std::memset( v, 0xFF, sizeof( v ) );
+
+    BOOST_TEST_EQ( net::ones_complement_sum( v, 300 ), 0xFFFFu );
+    BOOST_TEST_EQ( net::internet_checksum( v, 300 ), 0u );
+}
+
+int main()
+{
+    test_rfc1071();
+    test_ipv4();
+    test_lengths();
+
+    return boost::report_errors();
+}
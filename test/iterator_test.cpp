@@ -0,0 +1,157 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/iterator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+template<class T> static void test_bulk( T const * v, std::size_t n )
+{
+    std::vector<unsigned char> b1( n * sizeof(T) ), b2( n * sizeof(T) );
+
+    endian_store_n<T, order::big>( v, n, b1.data() );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        endian_store<T, sizeof(T), order::big>( &b2[ i * sizeof(T) ], v[ i ] );
+    }
+
+    BOOST_TEST( b1 == b2 );
+
+    std::vector<T> w( n );
+
+    endian_load_n<T, order::big>( b1.data(), n, w.data() );
+    BOOST_TEST( std::equal( w.begin(), w.end(), v ) );
+
+    endian_store_n<T, order::little>( v, n, b1.data() );
+    endian_load_n<T, order::little>( b1.data(), n, w.data() );
+    BOOST_TEST( std::equal( w.begin(), w.end(), v ) );
+
+    endian_reverse_inplace_n( w.data(), n );
+    endian_reverse_inplace_n( w.data(), n );
+    BOOST_TEST( std::equal( w.begin(), w.end(), v ) );
+}
+
+static void test_bulk()
+{
+    std::uint8_t v8[] = { 1, 2, 3 };
+    std::uint16_t v16[] = { 0x0102, 0x0304, 0x0506, 0x0708, 0x090A };
+    std::int32_t v32[] = { 0x01020304, -5, 0x7F000001, 0, -1, 17, 0x12345678 };
+    std::uint64_t v64[] = { 0x0102030405060708ULL, 0xF1F2F3F4F5F6F7F8ULL, 0 };
+    float vf[] = { 1.0f, -2.5f, 3.25f };
+    double vd[] = { 1.0, -2.5, 1e300 };
+
+    test_bulk( v8, 3 );
+    test_bulk( v16, 5 );
+    test_bulk( v32, 7 );
+    test_bulk( v64, 3 );
+    test_bulk( vf, 3 );
+    test_bulk( vd, 3 );
+
+    unsigned char b[ 4 ] = { 0x01, 0x02, 0x03, 0x04 };
+    std::uint16_t w[ 2 ];
+
+    endian_load_n<std::uint16_t, order::big>( b, 2, w );
+
+    BOOST_TEST_EQ( w[0], 0x0102 );
+    BOOST_TEST_EQ( w[1], 0x0304 );
+
+    endian_reverse_inplace_n( w, 2 );
+
+    BOOST_TEST_EQ( w[0], 0x0201 );
+    BOOST_TEST_EQ( w[1], 0x0403 );
+}
+
+static void test_iterators()
+{
+    std::vector<std::uint32_t> v;
+
+    for( std::uint32_t i = 0; i < 37; ++i )
+    {
+        v.push_back( 0x01020304u * i + i );
+    }
+
+    std::vector<unsigned char> b1( v.size() * 4 ), b2( v.size() * 4 ), b3( v.size() * 4 );
+
+    // std::copy, element by element
+
+    big_output_iterator<std::uint32_t> it = std::copy( v.begin(), v.end(), big_output_iterator<std::uint32_t>( b1.data() ) );
+    BOOST_TEST( it.base() == b1.data() + b1.size() );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        BOOST_TEST_EQ( load_big_u32( &b1[ i * 4 ] ), v[ i ] );
+    }
+
+    // endian_copy, bulk from a pointer range
+
+    it = endian_copy( v.data(), v.data() + v.size(), big_output_iterator<std::uint32_t>( b2.data() ) );
+    BOOST_TEST( it.base() == b2.data() + b2.size() );
+    BOOST_TEST( b1 == b2 );
+
+    // endian_copy, element by element from a non-contiguous range
+
+    std::list<std::uint32_t> l( v.begin(), v.end() );
+
+    endian_copy( l.begin(), l.end(), big_output_iterator<std::uint32_t>( b3.data() ) );
+    BOOST_TEST( b1 == b3 );
+
+    // input iterators
+
+    big_input_iterator<std::uint32_t> first( b1.data() ), last( b1.data() + b1.size() );
+
+    BOOST_TEST_EQ( last - first, static_cast<std::ptrdiff_t>( v.size() ) );
+    BOOST_TEST_EQ( *first, v[0] );
+    BOOST_TEST_EQ( first[ 5 ], v[ 5 ] );
+    BOOST_TEST_EQ( *( first + 7 ), v[ 7 ] );
+    BOOST_TEST( first < last );
+
+    std::vector<std::uint32_t> w( v.size() );
+
+    std::copy( first, last, w.begin() );
+    BOOST_TEST( v == w );
+
+    std::vector<std::uint32_t> w2( v.size() );
+
+    std::uint32_t * e = endian_copy( first, last, w2.data() );
+    BOOST_TEST( e == w2.data() + w2.size() );
+    BOOST_TEST( v == w2 );
+
+    std::list<std::uint32_t> l2( v.size() );
+
+    endian_copy( first, last, l2.begin() );
+    BOOST_TEST( l == l2 );
+
+    // 24 bit little endian
+
+    std::int32_t s[] = { -1, 0x7FFFFF, -0x800000, 5 };
+    unsigned char b24[ 12 ];
+
+    std::copy( s, s + 4, little_output_iterator<std::int32_t, 3>( b24 ) );
+
+    BOOST_TEST_EQ( b24[0], 0xFF );
+    BOOST_TEST_EQ( b24[3], 0xFF );
+    BOOST_TEST_EQ( b24[5], 0x7F );
+    BOOST_TEST_EQ( b24[9], 0x05 );
+
+    std::int32_t s2[ 4 ];
+
+    endian_copy( little_input_iterator<std::int32_t, 3>( b24 ), little_input_iterator<std::int32_t, 3>( b24 + 12 ), s2 );
+    BOOST_TEST( std::equal( s, s + 4, s2 ) );
+}
+
+int main()
+{
+    test_bulk();
+    test_iterators();
+
+    return boost::report_errors();
+}
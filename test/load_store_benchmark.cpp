@@ -0,0 +1,295 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Measures the endian_load and endian_store hot paths, one element at a
+// time and in bulk, and prints the results as JSON: the times, in
+// picoseconds per element, and the ratios, in percent, of each time to
+// that of a reference loop that moves the same bytes with std::memcpy and
+// doesn't use the library. The ratios are compared against a baseline by
+// benchmark/run_benchmark.cmake; unlike the times, they don't depend on the
+// clock speed or the load of the machine. Since the native byte order cases
+// are measured against the same references, a slowdown shared by all byte
+// orders shows in the ratios as well.
+//
+// Usage: load_store_benchmark [iterations]
+//
+// A case and its reference alternately make `iterations` passes over a
+// buffer of 65536 elements, nine times each. The fastest time of the case,
+// and the median of the nine ratios, are reported. The buffers don't fit in
+// the L1 cache, so that a reference isn't timed at a copy rate that only a
+// few kilobytes of L1-resident data reach.
+//
+// A case and its reference handle the same number of elements, so the
+// ratios of the byte-swapping cases grow as the elements get narrower: the
+// swap costs about the same per element, while the reference moves fewer
+// bytes per element.
+
+#include <boost/endian/conversion.hpp>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+using namespace boost::endian;
+
+static std::size_t const N = 65536;
+
+static std::size_t iterations = 500;
+
+static std::uint64_t sink;
+
+// the bytes, and the same values as arrays of each element type, so that
+// every array is accessed through its own type
+
+struct benchmark_data
+{
+    std::vector<unsigned char> bytes;
+
+    std::vector<std::uint16_t> u16;
+    std::vector<std::uint32_t> u32;
+    std::vector<std::uint64_t> u64;
+};
+
+template<class T> static std::vector<T>& elements( benchmark_data& d );
+
+template<> std::vector<std::uint16_t>& elements<std::uint16_t>( benchmark_data& d )
+{
+    return d.u16;
+}
+
+template<> std::vector<std::uint32_t>& elements<std::uint32_t>( benchmark_data& d )
+{
+    return d.u32;
+}
+
+template<> std::vector<std::uint64_t>& elements<std::uint64_t>( benchmark_data& d )
+{
+    return d.u64;
+}
+
+template<class T, order Order> static void load_one( benchmark_data& d )
+{
+    unsigned char const * p = d.bytes.data();
+
+    T s = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        s ^= endian_load<T, sizeof(T), Order>( p + i * sizeof(T) );
+    }
+
+    sink += s;
+}
+
+template<class T, order Order> static void store_one( benchmark_data& d )
+{
+    unsigned char * p = d.bytes.data();
+    T const * w = elements<T>( d ).data();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        endian_store<T, sizeof(T), Order>( p + i * sizeof(T), w[ i ] );
+    }
+
+    sink += p[ 0 ];
+}
+
+template<class T, order Order> static void load_n( benchmark_data& d )
+{
+    T * out = elements<T>( d ).data();
+
+    endian_load_n<T, Order>( d.bytes.data(), N, out );
+
+    sink += out[ N - 1 ];
+}
+
+template<class T, order Order> static void store_n( benchmark_data& d )
+{
+    endian_store_n<T, Order>( elements<T>( d ).data(), N, d.bytes.data() );
+
+    sink += d.bytes[ 0 ];
+}
+
+// the references
+
+template<class T> static void load_raw( benchmark_data& d )
+{
+    unsigned char const * p = d.bytes.data();
+
+    T s = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        T x;
+        std::memcpy( &x, p + i * sizeof(T), sizeof(T) );
+
+        s ^= x;
+    }
+
+    sink += s;
+}
+
+template<class T> static void store_raw( benchmark_data& d )
+{
+    unsigned char * p = d.bytes.data();
+    T const * w = elements<T>( d ).data();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        T x = w[ i ];
+        std::memcpy( p + i * sizeof(T), &x, sizeof(T) );
+    }
+
+    sink += p[ 0 ];
+}
+
+template<class T> static void load_n_raw( benchmark_data& d )
+{
+    T * out = elements<T>( d ).data();
+
+    std::memcpy( out, d.bytes.data(), N * sizeof(T) );
+
+    sink += out[ N - 1 ];
+}
+
+template<class T> static void store_n_raw( benchmark_data& d )
+{
+    std::memcpy( d.bytes.data(), elements<T>( d ).data(), N * sizeof(T) );
+
+    sink += d.bytes[ 0 ];
+}
+
+typedef void (*case_fn)( benchmark_data& );
+
+struct benchmark_case
+{
+    char const * name;
+    case_fn f;
+
+    // the reference loop over the same bytes
+    case_fn ref;
+};
+
+static double time_case( case_fn f, benchmark_data& d )
+{
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    for( std::size_t j = 0; j < iterations; ++j )
+    {
+        f( d );
+    }
+
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>( t2 - t1 ).count();
+}
+
+static void run( benchmark_case const & c, double & ps, double & ratio )
+{
+    benchmark_data d;
+
+    d.bytes.resize( N * 8 );
+    d.u16.resize( N );
+    d.u32.resize( N );
+    d.u64.resize( N );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        std::uint64_t w = 0x9E3779B97F4A7C15ULL * ( i + 1 );
+
+        store_little_u64( d.bytes.data() + i * 8, w );
+
+        d.u16[ i ] = static_cast<std::uint16_t>( w );
+        d.u32[ i ] = static_cast<std::uint32_t>( w );
+        d.u64[ i ] = w;
+    }
+
+    int const runs = 9;
+
+    double best = 0;
+    double ratios[ runs ];
+
+    for( int k = 0; k < runs; ++k )
+    {
+        double s = time_case( c.f, d );
+        double r = time_case( c.ref, d );
+
+        if( k == 0 || s < best ) best = s;
+
+        // a case and its reference, timed back to back, see the same
+        // clock speed and load, which cancel out of their ratio
+        ratios[ k ] = s / r;
+    }
+
+    std::sort( ratios, ratios + runs );
+
+    ps = best * 1e12 / static_cast<double>( iterations * N );
+    ratio = ratios[ runs / 2 ] * 100;
+}
+
+int main( int argc, char const* argv[] )
+{
+    if( argc > 1 )
+    {
+        iterations = static_cast<std::size_t>( std::strtoul( argv[ 1 ], 0, 10 ) );
+    }
+
+    if( iterations == 0 )
+    {
+        std::cerr << "usage: load_store_benchmark [iterations]\n";
+        return 2;
+    }
+
+    benchmark_case const cases[] =
+    {
+        { "load_native_u32", load_one<std::uint32_t, order::native>, load_raw<std::uint32_t> },
+        { "load_big_u16", load_one<std::uint16_t, order::big>, load_raw<std::uint16_t> },
+        { "load_big_u32", load_one<std::uint32_t, order::big>, load_raw<std::uint32_t> },
+        { "load_big_u64", load_one<std::uint64_t, order::big>, load_raw<std::uint64_t> },
+        { "load_little_u32", load_one<std::uint32_t, order::little>, load_raw<std::uint32_t> },
+
+        { "store_native_u32", store_one<std::uint32_t, order::native>, store_raw<std::uint32_t> },
+        { "store_big_u16", store_one<std::uint16_t, order::big>, store_raw<std::uint16_t> },
+        { "store_big_u32", store_one<std::uint32_t, order::big>, store_raw<std::uint32_t> },
+        { "store_big_u64", store_one<std::uint64_t, order::big>, store_raw<std::uint64_t> },
+        { "store_little_u32", store_one<std::uint32_t, order::little>, store_raw<std::uint32_t> },
+
+        { "load_n_native_u32", load_n<std::uint32_t, order::native>, load_n_raw<std::uint32_t> },
+        { "load_n_big_u32", load_n<std::uint32_t, order::big>, load_n_raw<std::uint32_t> },
+        { "load_n_big_u64", load_n<std::uint64_t, order::big>, load_n_raw<std::uint64_t> },
+        { "store_n_native_u32", store_n<std::uint32_t, order::native>, store_n_raw<std::uint32_t> },
+        { "store_n_big_u32", store_n<std::uint32_t, order::big>, store_n_raw<std::uint32_t> },
+        { "store_n_big_u64", store_n<std::uint64_t, order::big>, store_n_raw<std::uint64_t> },
+    };
+
+    std::size_t const n = sizeof( cases ) / sizeof( cases[ 0 ] );
+
+    double ps[ n ], ratio[ n ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        run( cases[ i ], ps[ i ], ratio[ i ] );
+    }
+
+    std::cout << "{\n  \"iterations\": " << iterations << ",\n  \"results\": {\n";
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::cout << "    \"" << cases[ i ].name << "\": " << static_cast<std::uint64_t>( ps[ i ] + 0.5 ) << ( i + 1 < n? ",\n": "\n" );
+    }
+
+    std::cout << "  },\n  \"ratios\": {\n";
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::cout << "    \"" << cases[ i ].name << "\": " << static_cast<std::uint64_t>( ratio[ i ] + 0.5 ) << ( i + 1 < n? ",\n": "\n" );
+    }
+
+    std::cout << "  },\n  \"checksum\": " << sink << "\n}\n";
+}
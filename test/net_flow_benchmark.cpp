@@ -0,0 +1,365 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Decodes the IPv4 TCP/UDP 5-tuple of each frame, once through the header
+// views and once with a parser that assembles each field from individual
+// bytes, and compares their speed. The views should cost nothing over the
+// hand-written parser.
+//
+// Usage: net_flow_benchmark [file.pcap]
+//        net_flow_benchmark --write file.pcap
+//
+// Without arguments, a synthetic mix of TCP, UDP, VLAN-tagged and non-IPv4
+// frames is generated. --write stores that mix as a pcap file, so that the
+// same input can be replayed later or inspected with other tools.
+
+#include <boost/endian/net.hpp>
+#include <boost/endian/conversion.hpp>
+#include <chrono>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+typedef std::vector<unsigned char> frame;
+
+// the decoded 5-tuples, in host byte order, as a structure of arrays
+
+struct flow_arrays
+{
+    std::uint32_t * source_address;
+    std::uint32_t * destination_address;
+    std::uint16_t * source_port;
+    std::uint16_t * destination_port;
+    std::uint8_t * protocol;
+};
+
+static std::vector<frame> synthesize( std::size_t n )
+{
+    std::vector<frame> r;
+    r.reserve( n );
+
+    std::uint32_t x = 0x12345678;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1103515245 + 12345;
+
+        unsigned kind = ( x >> 16 ) % 8;
+
+        bool vlan = kind == 3;
+        bool ipv4 = kind != 7;
+        bool tcp = kind < 5;
+
+        frame f( 14 + ( vlan? 4: 0 ) + 20 + ( tcp? 20: 8 ) + ( x >> 24 ) % 64 );
+
+        unsigned char * p = &f[ 0 ];
+
+        p += 12;
+
+        if( vlan )
+        {
+            store_big_u16( p, net::ether_type_vlan );
+            store_big_u16( p + 2, 100 );
+            p += 4;
+        }
+
+        store_big_u16( p, ipv4? net::ether_type_ipv4: net::ether_type_ipv6 );
+        p += 2;
+
+        net::ipv4_header * ip = net::header_cast<net::ipv4_header>( p );
+
+        ip->version_ihl = 0x45;
+        ip->total_length = static_cast<std::uint16_t>( f.size() - ( p - &f[ 0 ] ) );
+        ip->ttl = 64;
+        ip->protocol = tcp? net::ip_protocol_tcp: net::ip_protocol_udp;
+        ip->source = 0x0A000000 + ( x & 0xFFFF );
+        ip->destination = 0xC0A80000 + ( x >> 20 );
+
+        net::udp_header * ports = net::header_cast<net::udp_header>( p + 20 );
+
+        ports->source_port = static_cast<std::uint16_t>( 1024 + x % 50000 );
+        ports->destination_port = static_cast<std::uint16_t>( tcp? 443: 53 );
+
+        r.push_back( f );
+    }
+
+    return r;
+}
+
+static bool read_pcap( char const * fn, std::vector<frame> & r )
+{
+    std::ifstream is( fn, std::ios::binary );
+    std::vector<unsigned char> data( ( std::istreambuf_iterator<char>( is ) ), std::istreambuf_iterator<char>() );
+
+    if( data.size() < 24 ) return false;
+
+    // the file is written in the byte order of the capturing host
+
+    std::uint32_t magic = load_little_u32( &data[ 0 ] );
+
+    bool little = magic == 0xA1B2C3D4 || magic == 0xA1B23C4D;
+
+    if( !little )
+    {
+        magic = load_big_u32( &data[ 0 ] );
+        if( magic != 0xA1B2C3D4 && magic != 0xA1B23C4D ) return false;
+    }
+
+    std::uint32_t linktype = little? load_little_u32( &data[ 20 ] ): load_big_u32( &data[ 20 ] );
+
+    if( linktype != 1 ) return false; // LINKTYPE_ETHERNET
+
+    for( std::size_t i = 24; i + 16 <= data.size(); )
+    {
+        std::uint32_t len = little? load_little_u32( &data[ i + 8 ] ): load_big_u32( &data[ i + 8 ] );
+
+        i += 16;
+
+        if( len > data.size() - i ) break;
+
+        r.push_back( frame( data.begin() + i, data.begin() + i + len ) );
+        i += len;
+    }
+
+    return true;
+}
+
+static void write_pcap( char const * fn, std::vector<frame> const & v )
+{
+    std::ofstream os( fn, std::ios::binary );
+
+    unsigned char h[ 24 ] = {};
+
+    store_little_u32( h, 0xA1B2C3D4 );
+    store_little_u16( h + 4, 2 );
+    store_little_u16( h + 6, 4 );
+    store_little_u32( h + 16, 65535 );
+    store_little_u32( h + 20, 1 );
+
+    os.write( reinterpret_cast<char const*>( h ), sizeof( h ) );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        unsigned char r[ 16 ] = {};
+
+        store_little_u32( r + 4, static_cast<std::uint32_t>( i ) );
+        store_little_u32( r + 8, static_cast<std::uint32_t>( v[ i ].size() ) );
+        store_little_u32( r + 12, static_cast<std::uint32_t>( v[ i ].size() ) );
+
+        os.write( reinterpret_cast<char const*>( r ), sizeof( r ) );
+        os.write( reinterpret_cast<char const*>( &v[ i ][ 0 ] ), v[ i ].size() );
+    }
+}
+
+// per-packet field access through the header views
+
+static std::size_t decode_views( unsigned char const * const * packets, std::size_t const * lengths, std::size_t n,
+    flow_arrays const & out, unsigned char * valid )
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char const * p = packets[ i ];
+        std::size_t len = lengths[ i ];
+
+        bool v = false;
+
+        std::size_t off = sizeof( net::ethernet_header );
+        std::uint16_t type = len >= off? net::header_cast<net::ethernet_header>( p )->ether_type.value(): 0;
+
+        if( type == net::ether_type_vlan && len >= off + sizeof( net::vlan_tag ) )
+        {
+            type = net::header_cast<net::vlan_tag>( p + off )->ether_type.value();
+            off += sizeof( net::vlan_tag );
+        }
+
+        if( type == net::ether_type_ipv4 && len >= off + sizeof( net::ipv4_header ) )
+        {
+            net::ipv4_header const * ip = net::header_cast<net::ipv4_header>( p + off );
+
+            std::size_t ihl = ip->header_length();
+            std::uint8_t proto = ip->protocol.value();
+
+            std::size_t th = proto == net::ip_protocol_tcp? sizeof( net::tcp_header ): proto == net::ip_protocol_udp? sizeof( net::udp_header ): 0;
+
+            if( ip->version() == 4 && ihl >= sizeof( net::ipv4_header ) && ip->fragment_offset() == 0 && th != 0 && len >= off + ihl + th )
+            {
+                net::udp_header const * ports = net::header_cast<net::udp_header>( p + off + ihl );
+
+                out.source_address[ i ] = ip->source.value();
+                out.destination_address[ i ] = ip->destination.value();
+                out.source_port[ i ] = ports->source_port.value();
+                out.destination_port[ i ] = ports->destination_port.value();
+                out.protocol[ i ] = proto;
+
+                v = true;
+            }
+        }
+
+        if( !v )
+        {
+            out.source_address[ i ] = 0;
+            out.destination_address[ i ] = 0;
+            out.source_port[ i ] = 0;
+            out.destination_port[ i ] = 0;
+            out.protocol[ i ] = 0;
+        }
+
+        valid[ i ] = v;
+        r += v;
+    }
+
+    return r;
+}
+
+// reference implementation, assembling each field from individual bytes
+
+static std::size_t decode_scalar( unsigned char const * const * packets, std::size_t const * lengths, std::size_t n,
+    flow_arrays const & out, unsigned char * valid )
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char const * p = packets[ i ];
+        std::size_t len = lengths[ i ];
+
+        bool v = false;
+
+        std::size_t off = 14;
+        unsigned type = len >= 14? ( p[ 12 ] << 8 | p[ 13 ] ): 0;
+
+        if( type == 0x8100 && len >= 18 )
+        {
+            type = p[ 16 ] << 8 | p[ 17 ];
+            off = 18;
+        }
+
+        if( type == 0x0800 && len >= off + 20 && ( p[ off ] >> 4 ) == 4 )
+        {
+            std::size_t ihl = ( p[ off ] & 0x0F ) * 4u;
+            unsigned proto = p[ off + 9 ];
+            unsigned frag = ( p[ off + 6 ] << 8 | p[ off + 7 ] ) & 0x1FFF;
+
+            std::size_t th = proto == 6? 20: proto == 17? 8: 0;
+
+            if( ihl >= 20 && frag == 0 && th != 0 && len >= off + ihl + th )
+            {
+                unsigned char const * q = p + off;
+
+                out.source_address[ i ] = static_cast<std::uint32_t>( q[ 12 ] ) << 24 | q[ 13 ] << 16 | q[ 14 ] << 8 | q[ 15 ];
+                out.destination_address[ i ] = static_cast<std::uint32_t>( q[ 16 ] ) << 24 | q[ 17 ] << 16 | q[ 18 ] << 8 | q[ 19 ];
+                out.source_port[ i ] = static_cast<std::uint16_t>( q[ ihl ] << 8 | q[ ihl + 1 ] );
+                out.destination_port[ i ] = static_cast<std::uint16_t>( q[ ihl + 2 ] << 8 | q[ ihl + 3 ] );
+                out.protocol[ i ] = static_cast<std::uint8_t>( proto );
+
+                v = true;
+            }
+        }
+
+        if( !v )
+        {
+            out.source_address[ i ] = 0;
+            out.destination_address[ i ] = 0;
+            out.source_port[ i ] = 0;
+            out.destination_port[ i ] = 0;
+            out.protocol[ i ] = 0;
+        }
+
+        valid[ i ] = v;
+        r += v;
+    }
+
+    return r;
+}
+
+typedef std::size_t (*decode_fn)( unsigned char const * const *, std::size_t const *, std::size_t, flow_arrays const &, unsigned char * );
+
+static std::uint64_t run( char const * name, decode_fn f, std::vector<unsigned char const*> const & packets, std::vector<std::size_t> const & lengths, int rounds )
+{
+    std::size_t n = packets.size();
+
+    std::vector<std::uint32_t> src( n ), dst( n );
+    std::vector<std::uint16_t> sport( n ), dport( n );
+    std::vector<std::uint8_t> proto( n );
+    std::vector<unsigned char> valid( n );
+
+    flow_arrays out = { &src[ 0 ], &dst[ 0 ], &sport[ 0 ], &dport[ 0 ], &proto[ 0 ] };
+
+    std::uint64_t checksum = 0;
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    for( int k = 0; k < rounds; ++k )
+    {
+        checksum += f( &packets[ 0 ], &lengths[ 0 ], n, out, &valid[ 0 ] );
+
+        for( std::size_t i = 0; i < n; i += 97 )
+        {
+            checksum += src[ i ] ^ dport[ i ];
+        }
+    }
+
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    double s = std::chrono::duration<double>( t2 - t1 ).count();
+
+    std::cout << name << ": " << static_cast<double>( n ) * rounds / s / 1e6 << " Mpps (checksum " << checksum << ")\n";
+
+    return checksum;
+}
+
+int main( int argc, char const * argv[] )
+{
+    std::vector<frame> frames;
+
+    if( argc == 3 && std::strcmp( argv[ 1 ], "--write" ) == 0 )
+    {
+        write_pcap( argv[ 2 ], synthesize( 1 << 16 ) );
+        return 0;
+    }
+    else if( argc == 2 )
+    {
+        if( !read_pcap( argv[ 1 ], frames ) || frames.empty() )
+        {
+            std::cerr << argv[ 1 ] << ": not an Ethernet pcap file\n";
+            return 1;
+        }
+    }
+    else
+    {
+        frames = synthesize( 1 << 16 );
+    }
+
+    std::vector<unsigned char const*> packets( frames.size() );
+    std::vector<std::size_t> lengths( frames.size() );
+
+    for( std::size_t i = 0; i < frames.size(); ++i )
+    {
+        packets[ i ] = &frames[ i ][ 0 ];
+        lengths[ i ] = frames[ i ].size();
+    }
+
+    int rounds = static_cast<int>( ( 1 << 24 ) / frames.size() ) + 1;
+
+    std::cout << frames.size() << " frames, " << rounds << " rounds\n";
+
+    std::uint64_t c1 = run( "scalar", decode_scalar, packets, lengths, rounds );
+    std::uint64_t c2 = run( "per-packet views", decode_views, packets, lengths, rounds );
+    if( c1 != c2 )
+    {
+        std::cerr << "checksum mismatch\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+// Ethernet + 802.1Q + IPv4 + TCP, captured SYN
+
+static unsigned char const tcp_frame[] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0x81, 0x00,
+    0x20, 0x64, 0x08, 0x00,
+    0x45, 0x00, 0x00, 0x28, 0x1C, 0x46, 0x40, 0x00, 0x40, 0x06, 0x00, 0x00,
+    0xC0, 0xA8, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x02,
+    0xC3, 0x50, 0x01, 0xBB, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x02, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Ethernet + IPv4 with options + UDP
+
+static unsigned char const udp_frame[] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0x08, 0x00,
+    0x46, 0x00, 0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x40, 0x11, 0x00, 0x00,
+    0x0A, 0x01, 0x02, 0x03, 0x0A, 0x04, 0x05, 0x06,
+    0x01, 0x01, 0x01, 0x01,
+    0x00, 0x35, 0x9C, 0x40, 0x00, 0x0C, 0x00, 0x00,
+    0xDE, 0xAD, 0xBE, 0xEF,
+};
+
+// Ethernet + IPv6 + UDP
+
+static unsigned char const ipv6_frame[] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0x86, 0xDD,
+    0x6A, 0xB1, 0x23, 0x45, 0x00, 0x08, 0x11, 0x40,
+    0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0x04, 0xD2, 0x16, 0x2E, 0x00, 0x08, 0x00, 0x00,
+};
+
+static void test_headers()
+{
+    net::ethernet_header const * eth = net::header_cast<net::ethernet_header>( tcp_frame );
+
+    BOOST_TEST_EQ( eth->ether_type.value(), net::ether_type_vlan );
+    BOOST_TEST_EQ( eth->source[ 0 ], 0x66 );
+
+    net::vlan_tag const * vlan = net::header_cast<net::vlan_tag>( tcp_frame + 14 );
+
+    BOOST_TEST_EQ( vlan->priority(), 1u );
+    BOOST_TEST_EQ( vlan->vlan_id(), 100u );
+    BOOST_TEST_EQ( vlan->ether_type.value(), net::ether_type_ipv4 );
+
+    net::ipv4_header const * ip = net::header_cast<net::ipv4_header>( tcp_frame + 18 );
+
+    BOOST_TEST_EQ( ip->version(), 4u );
+    BOOST_TEST_EQ( ip->header_length(), 20u );
+    BOOST_TEST_EQ( ip->total_length.value(), 40u );
+    BOOST_TEST_EQ( ip->identification.value(), 0x1C46u );
+    BOOST_TEST( ip->dont_fragment() );
+    BOOST_TEST( !ip->more_fragments() );
+    BOOST_TEST_EQ( ip->fragment_offset(), 0u );
+    BOOST_TEST_EQ( ip->ttl.value(), 64u );
+    BOOST_TEST_EQ( ip->protocol.value(), net::ip_protocol_tcp );
+    BOOST_TEST_EQ( ip->source.value(), 0xC0A80001u );
+    BOOST_TEST_EQ( ip->destination.value(), 0x0A000002u );
+
+    net::tcp_header const * tcp = net::header_cast<net::tcp_header>( tcp_frame + 38 );
+
+    BOOST_TEST_EQ( tcp->source_port.value(), 50000u );
+    BOOST_TEST_EQ( tcp->destination_port.value(), 443u );
+    BOOST_TEST_EQ( tcp->sequence_number.value(), 0x12345678u );
+    BOOST_TEST_EQ( tcp->header_length(), 20u );
+    BOOST_TEST_EQ( tcp->flags(), net::tcp_syn );
+    BOOST_TEST_EQ( tcp->window.value(), 64240u );
+
+    net::ipv6_header const * ip6 = net::header_cast<net::ipv6_header>( ipv6_frame + 14 );
+
+    BOOST_TEST_EQ( ip6->version(), 6u );
+    BOOST_TEST_EQ( ip6->traffic_class(), 0xABu );
+    BOOST_TEST_EQ( ip6->flow_label(), 0x12345u );
+    BOOST_TEST_EQ( ip6->payload_length.value(), 8u );
+    BOOST_TEST_EQ( ip6->next_header.value(), net::ip_protocol_udp );
+    BOOST_TEST_EQ( ip6->hop_limit.value(), 64u );
+    BOOST_TEST_EQ( ip6->destination[ 15 ], 2 );
+
+    net::udp_header const * udp = net::header_cast<net::udp_header>( ipv6_frame + 54 );
+
+    BOOST_TEST_EQ( udp->source_port.value(), 1234u );
+    BOOST_TEST_EQ( udp->destination_port.value(), 5678u );
+    BOOST_TEST_EQ( udp->length.value(), 8u );
+}
+
+static void test_write()
+{
+    unsigned char frame[ sizeof( udp_frame ) ];
+    std::memcpy( frame, udp_frame, sizeof( frame ) );
+
+    net::udp_header * udp = net::header_cast<net::udp_header>( frame + 38 );
+
+    udp->destination_port = 8080;
+
+    BOOST_TEST_EQ( frame[ 40 ], 0x1F );
+    BOOST_TEST_EQ( frame[ 41 ], 0x90 );
+}
+
+int main()
+{
+    test_headers();
+    test_write();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,175 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Measures traversing a linked list stored with big_offset_ptr in place,
+// against decoding it into native nodes with ordinary pointers first, for
+// several list sizes. The nodes are in random order, as they would be in a
+// file written by an allocator.
+
+#include <boost/endian/offset_ptr.hpp>
+#include <boost/endian/buffers.hpp>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <utility>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+struct stored_node
+{
+    big_uint32_buf_t value;
+    big_offset_ptr<stored_node> next;
+};
+
+struct native_node
+{
+    std::uint32_t value;
+    native_node * next;
+};
+
+static stored_node * build( std::vector<unsigned char> & v, std::size_t n )
+{
+    v.resize( n * sizeof(stored_node) );
+
+    stored_node * p = ::new( &v[ 0 ] ) stored_node[ n ];
+
+    std::vector<std::size_t> order( n );
+
+    for( std::size_t i = 0; i < n; ++i ) order[ i ] = i;
+
+    std::uint32_t x = 0x12345678;
+
+    for( std::size_t i = n - 1; i > 0; --i )
+    {
+        x = x * 1664525 + 1013904223;
+        std::swap( order[ i ], order[ x % ( i + 1 ) ] );
+    }
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        stored_node & q = p[ order[ i ] ];
+
+        q.value = static_cast<std::uint32_t>( i );
+        q.next = i + 1 < n? &p[ order[ i + 1 ] ]: 0;
+    }
+
+    return &p[ order[ 0 ] ];
+}
+
+static std::uint64_t chase( stored_node const * p )
+{
+    std::uint64_t r = 0;
+
+    for( ; p; p = p->next.get() )
+    {
+        r += p->value.value();
+    }
+
+    return r;
+}
+
+static std::uint64_t chase( native_node const * p )
+{
+    std::uint64_t r = 0;
+
+    for( ; p; p = p->next )
+    {
+        r += p->value;
+    }
+
+    return r;
+}
+
+static native_node * decode( stored_node const * first, std::size_t n, stored_node const * head, std::vector<native_node> & out )
+{
+    out.resize( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        stored_node const * next = first[ i ].next.get();
+
+        out[ i ].value = first[ i ].value.value();
+        out[ i ].next = next? &out[ next - first ]: 0;
+    }
+
+    return &out[ head - first ];
+}
+
+static double seconds( std::chrono::steady_clock::time_point t1, std::chrono::steady_clock::time_point t2 )
+{
+    return std::chrono::duration<double>( t2 - t1 ).count();
+}
+
+int main()
+{
+    std::size_t const sizes[] = { 1000, 100000, 1000000 };
+
+    int r = 0;
+
+    for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+    {
+        std::size_t n = sizes[ i ];
+        std::size_t rounds = ( std::size_t( 1 ) << 26 ) / n;
+
+        std::vector<unsigned char> v;
+        stored_node const * head = build( v, n );
+        stored_node const * first = reinterpret_cast<stored_node const*>( &v[ 0 ] );
+
+        std::vector<native_node> w;
+
+        std::uint64_t c1 = 0, c2 = 0, c3 = 0;
+
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+        for( std::size_t k = 0; k < rounds; ++k )
+        {
+            c1 += chase( head );
+        }
+
+        std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+        native_node const * h2 = 0;
+
+        for( std::size_t k = 0; k < rounds; ++k )
+        {
+            h2 = decode( first, n, head, w );
+        }
+
+        std::chrono::steady_clock::time_point t3 = std::chrono::steady_clock::now();
+
+        for( std::size_t k = 0; k < rounds; ++k )
+        {
+            c2 += chase( h2 );
+        }
+
+        std::chrono::steady_clock::time_point t4 = std::chrono::steady_clock::now();
+
+        for( std::size_t k = 0; k < rounds; ++k )
+        {
+            c3 += chase( decode( first, n, head, w ) );
+        }
+
+        std::chrono::steady_clock::time_point t5 = std::chrono::steady_clock::now();
+
+        double const m = static_cast<double>( rounds * n );
+
+        std::cout << n << " nodes:\n";
+        std::cout << "  offset_ptr traversal: " << seconds( t1, t2 ) / m * 1e9 << " ns/node\n";
+        std::cout << "  decode: " << seconds( t2, t3 ) / m * 1e9 << " ns/node\n";
+        std::cout << "  native traversal: " << seconds( t3, t4 ) / m * 1e9 << " ns/node\n";
+        std::cout << "  decode and traversal: " << seconds( t4, t5 ) / m * 1e9 << " ns/node\n";
+
+        if( c1 != c2 || c1 != c3 )
+        {
+            std::cerr << "traversal mismatch\n";
+            r = 1;
+        }
+    }
+
+    return r;
+}
@@ -0,0 +1,201 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/offset_ptr.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+struct node
+{
+    big_uint32_buf_t value;
+    big_offset_ptr<node> left;
+    big_offset_ptr<node> right;
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(node) == 12 );
+BOOST_ENDIAN_STATIC_ASSERT( std::alignment_of<node>::value == 1 );
+
+BOOST_ENDIAN_STATIC_ASSERT( std::is_trivially_copyable< little_base_offset<node> >::value );
+
+// a binary search tree of the values 1..n, built in a byte buffer
+
+static node * build( unsigned char * p, std::uint32_t first, std::uint32_t last, std::size_t & used )
+{
+    if( first == last ) return 0;
+
+    std::uint32_t mid = first + ( last - first ) / 2;
+
+    node * r = ::new( p + used ) node;
+    used += sizeof(node);
+
+    r->value = mid;
+    r->left = build( p, first, mid, used );
+    r->right = build( p, mid + 1, last, used );
+
+    return r;
+}
+
+static bool contains( node const * r, std::uint32_t v )
+{
+    while( r )
+    {
+        std::uint32_t x = r->value.value();
+
+        if( v == x ) return true;
+
+        r = ( v < x? r->left: r->right ).get();
+    }
+
+    return false;
+}
+
+static void test_tree()
+{
+    std::uint32_t const n = 1000;
+
+    std::vector<unsigned char> v( n * sizeof(node) );
+    std::size_t used = 0;
+
+    node * root = build( v.data(), 1, n + 1, used );
+
+    BOOST_TEST_EQ( used, v.size() );
+    BOOST_TEST( root == reinterpret_cast<node*>( v.data() ) );
+
+    // the same bytes at another address
+
+    std::vector<unsigned char> w( v.size() + 3 );
+    std::memcpy( w.data() + 3, v.data(), v.size() );
+
+    node const * root2 = reinterpret_cast<node const*>( w.data() + 3 );
+
+    for( std::uint32_t i = 0; i <= n + 1; ++i )
+    {
+        bool r = i >= 1 && i <= n;
+
+        BOOST_TEST_EQ( contains( root, i ), r );
+        BOOST_TEST_EQ( contains( root2, i ), r );
+    }
+}
+
+static void test_layout()
+{
+    unsigned char buffer[ 32 ] = {};
+
+    big_offset_ptr<unsigned char> * p = ::new( buffer + 8 ) big_offset_ptr<unsigned char>;
+    little_offset_ptr<unsigned char> * q = ::new( buffer + 16 ) little_offset_ptr<unsigned char>;
+
+    BOOST_TEST( !*p );
+    BOOST_TEST( *p == nullptr );
+    BOOST_TEST_EQ( p->offset(), 0 );
+
+    *p = buffer + 24;
+    *q = buffer;
+
+    unsigned char const expected[] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0x00, 0x00, 0x00, 0x10, 0, 0, 0, 0,
+        0xF0, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0,
+    };
+
+    BOOST_TEST_EQ( std::memcmp( buffer, expected, sizeof(expected) ), 0 );
+
+    BOOST_TEST( p->get() == buffer + 24 );
+    BOOST_TEST( q->get() == buffer );
+    BOOST_TEST( *p != nullptr );
+    BOOST_TEST( *p == buffer + 24 );
+    BOOST_TEST( *q != buffer + 24 );
+    BOOST_TEST_EQ( p->offset(), 16 );
+    BOOST_TEST_EQ( q->offset(), -16 );
+
+    ( *p )[ 1 ] = 7;
+    BOOST_TEST_EQ( buffer[ 25 ], 7 );
+
+    // copies point to the same object
+
+    little_offset_ptr<unsigned char> * r = ::new( buffer + 20 ) little_offset_ptr<unsigned char>( *q );
+
+    BOOST_TEST( r->get() == buffer );
+    BOOST_TEST_EQ( r->offset(), -20 );
+    BOOST_TEST( *r == *q );
+
+    *q = nullptr;
+    BOOST_TEST( !*q );
+    BOOST_TEST( *r != *q );
+}
+
+static void test_range()
+{
+    unsigned char buffer[ 512 ];
+
+    endian_offset_ptr<unsigned char, order::big, std::int8_t> * p = ::new( buffer + 256 ) endian_offset_ptr<unsigned char, order::big, std::int8_t>;
+
+    BOOST_TEST( p->can_point_to( 0 ) );
+    BOOST_TEST( p->can_point_to( buffer + 256 + 127 ) );
+    BOOST_TEST( !p->can_point_to( buffer + 256 + 128 ) );
+    BOOST_TEST( p->can_point_to( buffer + 256 - 128 ) );
+    BOOST_TEST( !p->can_point_to( buffer + 256 - 129 ) );
+    BOOST_TEST( !p->can_point_to( buffer + 256 ) );
+
+    *p = buffer + 256 - 128;
+    BOOST_TEST( p->get() == buffer + 128 );
+}
+
+static void test_base_offset()
+{
+    unsigned char buffer[ 300 ] = {};
+
+    big_base_offset<std::uint16_t> a;
+    a.reset();
+
+    BOOST_TEST( !a );
+    BOOST_TEST( a.get( buffer ) == 0 );
+
+    std::uint16_t * x = reinterpret_cast<std::uint16_t*>( buffer + 258 );
+
+    BOOST_TEST( big_base_offset<std::uint16_t>::can_point_to( buffer, x ) );
+    BOOST_TEST( !big_base_offset<std::uint16_t>::can_point_to( buffer + 260, x ) );
+    BOOST_TEST( !big_base_offset<std::uint16_t>::can_point_to( buffer, reinterpret_cast<std::uint16_t*>( buffer ) ) );
+
+    a.set( buffer, x );
+
+    BOOST_TEST( !!a );
+    BOOST_TEST_EQ( a.offset(), 258u );
+    BOOST_TEST( a.get( buffer ) == x );
+    BOOST_TEST( a.get( buffer + 2 ) == x + 1 );
+
+    unsigned char const expected[] = { 0, 0, 0x01, 0x02 };
+    BOOST_TEST_EQ( std::memcmp( &a, expected, 4 ), 0 );
+
+    typedef little_base_offset<std::uint16_t, std::uint16_t> offset16;
+
+    offset16 b( 258 );
+
+    BOOST_TEST( b.get( buffer ) == x );
+    BOOST_TEST( b == offset16( 258 ) );
+    BOOST_TEST( b != offset16( 256 ) );
+
+    b.set( buffer, 0 );
+    BOOST_TEST( !b );
+}
+
+int main()
+{
+    test_tree();
+    test_layout();
+    test_range();
+    test_base_offset();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,211 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/pcm.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+template<order Order, std::size_t N> static void test_roundtrip( std::int32_t first, std::int32_t last, std::int32_t step )
+{
+    std::vector<std::int32_t> v;
+
+    for( std::int64_t s = first; s <= last; s += step )
+    {
+        v.push_back( static_cast<std::int32_t>( s ) );
+    }
+
+    v.push_back( last );
+
+    std::size_t const n = v.size();
+
+    std::vector<unsigned char> pcm( n * N );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        endian_store<std::int32_t, N, Order>( &pcm[ i * N ], v[ i ] );
+    }
+
+    std::vector<float> f( n );
+    pcm_to_float_n<Order, N>( &pcm[ 0 ], n, &f[ 0 ] );
+
+    double const scale = static_cast<double>( static_cast<std::uint32_t>( 1 ) << ( 8 * N - 1 ) );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( f[ i ], static_cast<float>( v[ i ] / scale ) );
+    }
+
+    std::vector<unsigned char> pcm2( n * N );
+    float_to_pcm_n<Order, N>( &f[ 0 ], n, &pcm2[ 0 ] );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::int32_t s = endian_load<std::int32_t, N, Order>( &pcm2[ i * N ] );
+
+        if( N < 4 )
+        {
+            // float represents 16 and 24 bit samples exactly
+            BOOST_TEST_EQ( s, v[ i ] );
+        }
+        else
+        {
+            // large 32 bit samples round to 1.0f, which clips to the maximum
+            double x = static_cast<double>( f[ i ] ) * scale;
+            BOOST_TEST_EQ( s, x >= scale? 2147483647: static_cast<std::int32_t>( x ) );
+        }
+    }
+}
+
+static void test_s16()
+{
+    unsigned char const be[] = { 0x00, 0x00, 0x40, 0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF };
+
+    float f[ 5 ];
+
+    big_s16_to_float_n( be, 5, f );
+
+    BOOST_TEST_EQ( f[ 0 ], 0.0f );
+    BOOST_TEST_EQ( f[ 1 ], 0.5f );
+    BOOST_TEST_EQ( f[ 2 ], -1.0f );
+    BOOST_TEST_EQ( f[ 3 ], 32767.0f / 32768 );
+    BOOST_TEST_EQ( f[ 4 ], -1.0f / 32768 );
+
+    unsigned char le[ 10 ];
+
+    float_to_little_s16_n( f, 5, le );
+
+    for( int i = 0; i < 5; ++i )
+    {
+        BOOST_TEST_EQ( le[ 2 * i ], be[ 2 * i + 1 ] );
+        BOOST_TEST_EQ( le[ 2 * i + 1 ], be[ 2 * i ] );
+    }
+}
+
+static void test_rounding_and_clipping()
+{
+    float const k = 1.0f / 32768;
+
+    float const f[] =
+    {
+        1.0f, 2.0f, -1.0f, -2.0f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(),
+        0.5f * k, -0.5f * k, 0.49f * k, -0.49f * k, 1.5f * k, -1.5f * k, 100.25f * k,
+    };
+
+    std::int32_t const expected[] =
+    {
+        32767, 32767, -32768, -32768,
+        32767, -32768,
+        0,
+        1, -1, 0, 0, 2, -2, 100,
+    };
+
+    std::size_t const n = sizeof( f ) / sizeof( f[0] );
+
+    unsigned char p[ n * 2 ];
+
+    float_to_big_s16_n( f, n, p );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( load_big_s16( p + i * 2 ), expected[ i ] );
+    }
+
+    unsigned char q[ n * 4 ];
+
+    float_to_little_s32_n( f, 7, q );
+
+    BOOST_TEST_EQ( load_little_s32( q ), 2147483647 );
+    BOOST_TEST_EQ( load_little_s32( q + 4 ), 2147483647 );
+    BOOST_TEST_EQ( load_little_s32( q + 8 ), -2147483647 - 1 );
+    BOOST_TEST_EQ( load_little_s32( q + 24 ), 0 );
+
+    unsigned char r[ n * 3 ];
+
+    float_to_big_s24_n( f, 7, r );
+
+    BOOST_TEST_EQ( load_big_s24( r ), 8388607 );
+    BOOST_TEST_EQ( load_big_s24( r + 6 ), -8388608 );
+    BOOST_TEST_EQ( load_big_s24( r + 18 ), 0 );
+}
+
+// values just below and at half a step, and at the ends of the range
+
+template<order Order, std::size_t N> static void test_half_steps()
+{
+    float const scale = static_cast<float>( static_cast<std::uint32_t>( 1 ) << ( 8 * N - 1 ) );
+    std::int32_t const hi = static_cast<std::int32_t>( ( static_cast<std::uint32_t>( 1 ) << ( 8 * N - 1 ) ) - 1 );
+
+    float const h = std::nextafter( 0.5f, 0.0f );
+    float const h3 = std::nextafter( 1.5f, 0.0f );
+    float const one = std::nextafter( 1.0f, 0.0f );
+
+    float const f[] =
+    {
+        h / scale, -h / scale, 0.5f / scale, -0.5f / scale,
+        h3 / scale, -h3 / scale, 1.5f / scale, -1.5f / scale,
+        1.0f, -1.0f, std::nextafter( -1.0f, -2.0f ),
+    };
+
+    std::int32_t const expected[] =
+    {
+        0, 0, 1, -1,
+        1, -1, 2, -2,
+        hi, -hi - 1, -hi - 1,
+    };
+
+    std::size_t const n = sizeof( f ) / sizeof( f[0] );
+
+    unsigned char p[ ( n + 2 ) * N ];
+
+    float_to_pcm_n<Order, N>( f, n, p );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( ( endian_load<std::int32_t, N, Order>( p + i * N ) ), expected[ i ] );
+    }
+
+    // the largest float below 1 is 32767.998, 8388607.5 and 2147483520
+    // steps, and the smallest above -1 is their negative
+
+    float const g[] = { one, -one };
+
+    float_to_pcm_n<Order, N>( g, 2, p + n * N );
+
+    std::int32_t const e1 = N == 4? 2147483520: hi;
+
+    BOOST_TEST_EQ( ( endian_load<std::int32_t, N, Order>( p + n * N ) ), e1 );
+    BOOST_TEST_EQ( ( endian_load<std::int32_t, N, Order>( p + ( n + 1 ) * N ) ), N == 4? -e1: -hi - 1 );
+}
+
+int main()
+{
+    test_roundtrip<order::big, 2>( -32768, 32767, 1 );
+    test_roundtrip<order::little, 2>( -32768, 32767, 1 );
+    test_roundtrip<order::big, 3>( -8388608, 8388607, 251 );
+    test_roundtrip<order::little, 3>( -8388608, 8388607, 251 );
+    test_roundtrip<order::big, 4>( -2147483647 - 1, 2147483647, 65537 * 251 );
+    test_roundtrip<order::little, 4>( -2147483647 - 1, 2147483647, 65537 * 251 );
+
+    test_s16();
+    test_rounding_and_clipping();
+
+    test_half_steps<order::big, 2>();
+    test_half_steps<order::little, 2>();
+    test_half_steps<order::big, 3>();
+    test_half_steps<order::little, 3>();
+    test_half_steps<order::big, 4>();
+    test_half_steps<order::little, 4>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/record.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+typedef record_layout<4, 2, 2, 8> layout;
+
+BOOST_ENDIAN_STATIC_ASSERT( layout::size == 16 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::field_count == 4 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::source_index( 0 ) == 3 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::source_index( 3 ) == 0 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::source_index( 4 ) == 5 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::source_index( 6 ) == 7 );
+BOOST_ENDIAN_STATIC_ASSERT( layout::source_index( 8 ) == 15 );
+
+struct wire_record
+{
+    big_uint32_buf_t a;
+    big_uint16_buf_t b;
+    big_int16_buf_t c;
+    big_uint64_buf_t d;
+};
+
+struct native_record
+{
+    std::uint32_t a;
+    std::uint16_t b;
+    std::int16_t c;
+    std::uint64_t d;
+};
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(wire_record) == 16 );
+BOOST_ENDIAN_STATIC_ASSERT( sizeof(native_record) == 16 );
+
+static void test_convert()
+{
+    std::size_t const n = 37;
+
+    wire_record w[ n ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        w[ i ].a = static_cast<std::uint32_t>( 0x01020304 * i );
+        w[ i ].b = static_cast<std::uint16_t>( 0x0506 + i );
+        w[ i ].c = static_cast<std::int16_t>( -static_cast<int>( i ) );
+        w[ i ].d = 0x0102030405060708ULL * i;
+    }
+
+    native_record r[ n ];
+
+    endian_convert_records_n< record_layout_of<big_uint32_buf_t, big_uint16_buf_t, big_int16_buf_t, big_uint64_buf_t>, order::big, order::native >(
+        reinterpret_cast<unsigned char*>( r ), reinterpret_cast<unsigned char const*>( w ), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( r[ i ].a, w[ i ].a.value() );
+        BOOST_TEST_EQ( r[ i ].b, w[ i ].b.value() );
+        BOOST_TEST_EQ( r[ i ].c, w[ i ].c.value() );
+        BOOST_TEST_EQ( r[ i ].d, w[ i ].d.value() );
+    }
+
+    // and back, in place
+
+    endian_convert_records_n<layout, order::native, order::big>( reinterpret_cast<unsigned char*>( r ), reinterpret_cast<unsigned char const*>( r ), n );
+
+    BOOST_TEST_EQ( std::memcmp( r, w, sizeof( w ) ), 0 );
+}
+
+static void test_reverse()
+{
+    // a 3-byte field, a 1-byte field, a 5-byte field
+
+    typedef record_layout<3, 1, 5> odd;
+
+    BOOST_ENDIAN_STATIC_ASSERT( odd::size == 9 );
+
+    unsigned char v[ 18 ];
+
+    for( std::size_t i = 0; i < sizeof( v ); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i );
+    }
+
+    endian_reverse_records_n<odd>( v, 2 );
+
+    unsigned char const expected[ 18 ] = { 2, 1, 0, 3, 8, 7, 6, 5, 4, 11, 10, 9, 12, 17, 16, 15, 14, 13 };
+
+    BOOST_TEST_EQ( std::memcmp( v, expected, sizeof( v ) ), 0 );
+
+    unsigned char const * p = odd::permutation();
+
+    for( std::size_t i = 0; i < odd::size; ++i )
+    {
+        BOOST_TEST_EQ( static_cast<std::size_t>( p[ i ] ), odd::source_index( i ) );
+    }
+
+    unsigned char w[ 18 ];
+
+    endian_convert_records_n<odd, order::little, order::little>( w, v, 2 );
+    BOOST_TEST_EQ( std::memcmp( v, w, sizeof( v ) ), 0 );
+
+    // v holds reversed records; converting them again restores the original
+
+    endian_convert_records_n<odd, order::little, order::big>( w, v, 2 );
+
+    for( std::size_t i = 0; i < sizeof( w ); ++i )
+    {
+        BOOST_TEST_EQ( static_cast<std::size_t>( w[ i ] ), i );
+    }
+}
+
+static void test_runtime_order()
+{
+    typedef record_layout<2, 4> layout2;
+
+    unsigned char v[ 12 ];
+
+    for( std::size_t i = 0; i < sizeof( v ); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i );
+    }
+
+    unsigned char w[ 12 ];
+
+    endian_convert_records_n<layout2>( w, v, 2, order::big, order::big );
+    BOOST_TEST_EQ( std::memcmp( v, w, sizeof( v ) ), 0 );
+
+    endian_convert_records_n<layout2>( w, v, 2, order::little, order::big );
+
+    unsigned char const expected[ 12 ] = { 1, 0, 5, 4, 3, 2, 7, 6, 11, 10, 9, 8 };
+    BOOST_TEST_EQ( std::memcmp( w, expected, sizeof( w ) ), 0 );
+
+    // in place
+
+    endian_convert_records_n<layout2>( w, w, 2, order::native, order::native );
+    BOOST_TEST_EQ( std::memcmp( w, expected, sizeof( w ) ), 0 );
+
+    endian_convert_records_n<layout2>( w, w, 2, order::big, order::little );
+    BOOST_TEST_EQ( std::memcmp( v, w, sizeof( v ) ), 0 );
+}
+
+int main()
+{
+    test_convert();
+    test_reverse();
+    test_runtime_order();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/sortable.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+template<class T> static void test_order( std::vector<T> const & v )
+{
+    std::size_t const n = v.size();
+
+    std::vector<unsigned char> keys( n * sizeof(T) );
+    store_sortable_keys_n( &v[ 0 ], n, &keys[ 0 ] );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char k[ sizeof(T) ];
+        store_sortable_key( k, v[ i ] );
+
+        BOOST_TEST_EQ( std::memcmp( k, &keys[ i * sizeof(T) ], sizeof(T) ), 0 );
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            int r = std::memcmp( &keys[ i * sizeof(T) ], &keys[ j * sizeof(T) ], sizeof(T) );
+
+            BOOST_TEST_EQ( r < 0, v[ i ] < v[ j ] );
+            BOOST_TEST_EQ( r > 0, v[ j ] < v[ i ] );
+        }
+    }
+
+    std::vector<T> w( n );
+    load_sortable_keys_n( &keys[ 0 ], n, &w[ 0 ] );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( std::memcmp( &v[ i ], &w[ i ], sizeof(T) ), 0 );
+
+        T x = load_sortable_key<T>( &keys[ i * sizeof(T) ] );
+        BOOST_TEST_EQ( std::memcmp( &v[ i ], &x, sizeof(T) ), 0 );
+    }
+}
+
+template<class T> static void test_integral()
+{
+    std::vector<T> v;
+
+    v.push_back( std::numeric_limits<T>::min() );
+    v.push_back( std::numeric_limits<T>::max() );
+    v.push_back( 0 );
+    v.push_back( 1 );
+    v.push_back( static_cast<T>( -1 ) );
+    v.push_back( static_cast<T>( 0x1234 ) );
+    v.push_back( static_cast<T>( -0x1234 ) );
+    v.push_back( static_cast<T>( std::numeric_limits<T>::min() + 1 ) );
+    v.push_back( static_cast<T>( std::numeric_limits<T>::max() - 1 ) );
+
+    test_order( v );
+}
+
+template<class T> static void test_floating()
+{
+    std::vector<T> v;
+
+    v.push_back( 0 );
+    v.push_back( 1 );
+    v.push_back( -1 );
+    v.push_back( static_cast<T>( 0.5 ) );
+    v.push_back( static_cast<T>( -0.5 ) );
+    v.push_back( static_cast<T>( 1e30 ) );
+    v.push_back( static_cast<T>( -1e30 ) );
+    v.push_back( std::numeric_limits<T>::min() );
+    v.push_back( -std::numeric_limits<T>::min() );
+    v.push_back( std::numeric_limits<T>::denorm_min() );
+    v.push_back( -std::numeric_limits<T>::denorm_min() );
+    v.push_back( std::numeric_limits<T>::max() );
+    v.push_back( -std::numeric_limits<T>::max() );
+    v.push_back( std::numeric_limits<T>::infinity() );
+    v.push_back( -std::numeric_limits<T>::infinity() );
+
+    test_order( v );
+
+    // -0.0 sorts immediately before +0.0
+
+    unsigned char k1[ sizeof(T) ], k2[ sizeof(T) ];
+
+    store_sortable_key( k1, -static_cast<T>( 0 ) );
+    store_sortable_key( k2, static_cast<T>( 0 ) );
+
+    BOOST_TEST_LT( std::memcmp( k1, k2, sizeof(T) ), 0 );
+
+    // a positive NaN sorts after +infinity
+
+    store_sortable_key( k1, std::numeric_limits<T>::infinity() );
+    store_sortable_key( k2, std::numeric_limits<T>::quiet_NaN() );
+
+    BOOST_TEST_LT( std::memcmp( k1, k2, sizeof(T) ), 0 );
+}
+
+static void test_encoding()
+{
+    unsigned char k[ 8 ];
+
+    store_sortable_key( k, std::int32_t( -1 ) );
+
+    BOOST_TEST_EQ( k[ 0 ], 0x7F );
+    BOOST_TEST_EQ( k[ 3 ], 0xFF );
+
+    store_sortable_key( k, std::uint16_t( 0x1234 ) );
+
+    BOOST_TEST_EQ( k[ 0 ], 0x12 );
+    BOOST_TEST_EQ( k[ 1 ], 0x34 );
+
+    store_sortable_key( k, 1.0f );
+
+    BOOST_TEST_EQ( k[ 0 ], 0xBF );
+    BOOST_TEST_EQ( k[ 1 ], 0x80 );
+
+    store_sortable_key( k, -1.0 );
+
+    BOOST_TEST_EQ( k[ 0 ], 0x40 );
+    BOOST_TEST_EQ( k[ 1 ], 0x0F );
+    BOOST_TEST_EQ( k[ 7 ], 0xFF );
+}
+
+int main()
+{
+    test_integral<std::int8_t>();
+    test_integral<std::int16_t>();
+    test_integral<std::int32_t>();
+    test_integral<std::int64_t>();
+    test_integral<std::uint8_t>();
+    test_integral<std::uint32_t>();
+    test_integral<std::uint64_t>();
+
+    test_floating<float>();
+    test_floating<double>();
+
+    test_encoding();
+
+    return boost::report_errors();
+}
@@ -17,6 +17,7 @@
 #define BOOST_ENDIAN_SPEED_TEST_FUNCTIONS_HPP
 
 #include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/endian/arithmetic.hpp>
 
 namespace user
@@ -0,0 +1,254 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/struct_format.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+static void test_parse()
+{
+    struct_format f( ">IHQ3sx" );
+
+    BOOST_TEST( f.valid() );
+    BOOST_TEST( f.byte_order() == order::big );
+    BOOST_TEST_EQ( f.size(), 18u );
+
+    if( BOOST_TEST_EQ( f.field_count(), 4u ) )
+    {
+        char const codes[] = { 'I', 'H', 'Q', 's' };
+        std::size_t const offsets[] = { 0, 4, 6, 14 };
+        std::size_t const sizes[] = { 4, 2, 8, 3 };
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            BOOST_TEST_EQ( f.field( i ).code, codes[ i ] );
+            BOOST_TEST_EQ( f.field( i ).offset, offsets[ i ] );
+            BOOST_TEST_EQ( f.field( i ).size, sizes[ i ] );
+        }
+    }
+
+    // repeat counts, whitespace, and the other byte orders
+
+    struct_format g( "< 2h 0s 3B\td ?c e f p x 2q" );
+
+    BOOST_TEST( g.valid() );
+    BOOST_TEST( g.byte_order() == order::little );
+    BOOST_TEST_EQ( g.size(), 4 + 0 + 3 + 8 + 1 + 1 + 2 + 4 + 1 + 1 + 16u );
+    BOOST_TEST_EQ( g.field_count(), 2 + 1 + 3 + 1 + 1 + 1 + 1 + 1 + 1 + 2u );
+
+    BOOST_TEST( struct_format( "!I" ).byte_order() == order::big );
+    BOOST_TEST( struct_format( std::string( "=iL" ) ).byte_order() == order::native );
+
+    // an empty record
+
+    BOOST_TEST( struct_format( ">" ).valid() );
+    BOOST_TEST_EQ( struct_format( ">" ).size(), 0u );
+}
+
+static void test_invalid()
+{
+    char const * const formats[] =
+    {
+        "", "IHQ", "@I", ">Z", ">n", ">N", ">P", ">3", ">I-", ">99999999999999999999999I",
+    };
+
+    for( std::size_t i = 0; i < sizeof( formats ) / sizeof( formats[ 0 ] ); ++i )
+    {
+        struct_format f( formats[ i ] );
+
+        BOOST_TEST( !f.valid() );
+        BOOST_TEST_EQ( f.size(), 0u );
+        BOOST_TEST_EQ( f.field_count(), 0u );
+    }
+
+    BOOST_TEST( !struct_format().valid() );
+}
+
+// a packed native record for "IHQ3sx"
+
+struct record
+{
+    std::uint32_t a;
+    std::uint16_t b;
+    std::uint64_t c;
+    char d[ 3 ];
+};
+
+static void store_native( unsigned char * p, record const & r )
+{
+    std::memcpy( p, &r.a, 4 );
+    std::memcpy( p + 4, &r.b, 2 );
+    std::memcpy( p + 6, &r.c, 8 );
+    std::memcpy( p + 14, r.d, 3 );
+    p[ 17 ] = 0;
+}
+
+static record make_record( std::size_t i )
+{
+    record r;
+
+    r.a = static_cast<std::uint32_t>( 0x01020304 + i );
+    r.b = static_cast<std::uint16_t>( 0xA0B0 + i );
+    r.c = 0x1122334455667788 + i;
+    r.d[ 0 ] = 'x'; r.d[ 1 ] = 'y'; r.d[ 2 ] = static_cast<char>( 'a' + i % 26 );
+
+    return r;
+}
+
+static void test_pack()
+{
+    struct_format f( ">IHQ3sx" );
+    struct_format g( "<IHQ3sx" );
+
+    record r = make_record( 0 );
+
+    unsigned char native[ 18 ];
+    store_native( native, r );
+
+    unsigned char big[ 18 ] = {};
+    store_big_u32( big, r.a );
+    store_big_u16( big + 4, r.b );
+    store_big_u64( big + 6, r.c );
+    std::memcpy( big + 14, r.d, 3 );
+
+    unsigned char little[ 18 ] = {};
+    store_little_u32( little, r.a );
+    store_little_u16( little + 4, r.b );
+    store_little_u64( little + 6, r.c );
+    std::memcpy( little + 14, r.d, 3 );
+
+    unsigned char out[ 18 ];
+
+    std::memset( out, 0xCC, sizeof(out) );
+    f.pack( native, out );
+    BOOST_TEST_EQ( std::memcmp( out, big, 18 ), 0 );
+
+    std::memset( out, 0xCC, sizeof(out) );
+    g.pack( native, out );
+    BOOST_TEST_EQ( std::memcmp( out, little, 18 ), 0 );
+
+    // unpacking sets the pad byte to zero
+
+    big[ 17 ] = 0xEE;
+
+    std::memset( out, 0xCC, sizeof(out) );
+    f.unpack( big, out );
+    BOOST_TEST_EQ( std::memcmp( out, native, 18 ), 0 );
+
+    // in place
+
+    f.unpack( big, big );
+    BOOST_TEST_EQ( std::memcmp( big, native, 18 ), 0 );
+
+    // the values can be read with the load functions
+
+    f.pack( native, out );
+
+    BOOST_TEST_EQ( load_big_u32( out + f.field( 0 ).offset ), r.a );
+    BOOST_TEST_EQ( load_big_u16( out + f.field( 1 ).offset ), r.b );
+    BOOST_TEST_EQ( load_big_u64( out + f.field( 2 ).offset ), r.c );
+}
+
+static void test_float()
+{
+    struct_format f( ">fd" );
+
+    float x = -1.5f;
+    double y = 0.1;
+
+    unsigned char native[ 12 ];
+    std::memcpy( native, &x, 4 );
+    std::memcpy( native + 4, &y, 8 );
+
+    unsigned char packed[ 12 ];
+    f.pack( native, packed );
+
+    BOOST_TEST_EQ( ( endian_load<float, 4, order::big>( packed ) ), x );
+    BOOST_TEST_EQ( ( endian_load<double, 8, order::big>( packed + 4 ) ), y );
+}
+
+static void test_plan()
+{
+    bool const little = order::native == order::little;
+
+    // adjacent fields of the same width are merged
+
+    BOOST_TEST_EQ( struct_format( ">IIHH3s4B" ).operation_count(), little? 3u: 1u );
+    BOOST_TEST_EQ( struct_format( "<IIHH3s4B" ).operation_count(), little? 1u: 3u );
+    BOOST_TEST_EQ( struct_format( ">4I" ).operation_count(), 1u );
+    BOOST_TEST_EQ( struct_format( "=IIHH3s4B" ).operation_count(), 1u );
+    BOOST_TEST_EQ( struct_format( "=I2xH" ).operation_count(), 3u );
+    BOOST_TEST_EQ( struct_format( ">I0HI" ).operation_count(), 1u );
+}
+
+static void test_arrays()
+{
+    char const * const formats[] = { ">IHQ3sx", "<IHQ3sx", "!4I", "=IHQ3sx" };
+
+    std::size_t const n = 37;
+
+    for( std::size_t k = 0; k < sizeof( formats ) / sizeof( formats[ 0 ] ); ++k )
+    {
+        struct_format f( formats[ k ] );
+        std::size_t const m = f.size();
+
+        std::vector<unsigned char> native( n * m );
+
+        for( std::size_t i = 0; i < n * m; ++i )
+        {
+            native[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+        }
+
+        // the pad bytes of the unpacked records are zero
+
+        if( m == 18 )
+        {
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                native[ i * m + 17 ] = 0;
+            }
+        }
+
+        // one call agrees with one record at a time
+
+        std::vector<unsigned char> packed( n * m ), packed2( n * m );
+
+        f.pack_n( native.data(), n, packed.data() );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            f.pack( native.data() + i * m, packed2.data() + i * m );
+        }
+
+        BOOST_TEST( packed == packed2 );
+
+        std::vector<unsigned char> unpacked( n * m );
+
+        f.unpack_n( packed.data(), n, unpacked.data() );
+        BOOST_TEST( unpacked == native );
+
+        f.unpack_n( packed.data(), n, packed.data() );
+        BOOST_TEST( packed == native );
+    }
+}
+
+int main()
+{
+    test_parse();
+    test_invalid();
+    test_pack();
+    test_float();
+    test_plan();
+    test_arrays();
+
+    return boost::report_errors();
+}
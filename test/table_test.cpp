@@ -0,0 +1,417 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/table.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+using namespace boost::endian;
+
+struct point
+{
+    little_int32_buf_t x;
+    little_int32_buf_t y;
+};
+
+enum class color: std::uint8_t { red = 1, green = 2, blue = 3 };
+
+// the fields of the tables "order" and "item"
+
+namespace field
+{
+
+std::size_t const id = 0;
+std::size_t const price = 1;
+std::size_t const name = 2;
+std::size_t const quantities = 3;
+std::size_t const position = 4;
+std::size_t const color = 5;
+std::size_t const parent = 6;
+std::size_t const items = 7;
+std::size_t const path = 8;
+
+std::size_t const item_name = 0;
+std::size_t const item_count = 1;
+
+} // namespace field
+
+static std::vector<unsigned char> build_order()
+{
+    endian_table_builder b;
+
+    // objects referenced by the table are created first
+
+    std::uint32_t name = b.create_string( "widget" );
+
+    std::int32_t const q[] = { 1, -2, 300000, -4000000 };
+    std::uint32_t quantities = b.create_vector( q, 4 );
+
+    std::uint32_t items[ 3 ];
+
+    for( int i = 0; i < 3; ++i )
+    {
+        std::uint32_t n = b.create_string( std::string( "item" ) + static_cast<char>( '0' + i ) );
+
+        b.start_table();
+        b.add_offset( field::item_name, n );
+        b.add<std::uint16_t>( field::item_count, static_cast<std::uint16_t>( 10 * i ) );
+        items[ i ] = b.end_table();
+    }
+
+    std::uint32_t vitems = b.create_offset_vector( items, 3 );
+
+    point path[ 2 ];
+    path[ 0 ].x = 1; path[ 0 ].y = 2;
+    path[ 1 ].x = -3; path[ 1 ].y = -4;
+
+    std::uint32_t vpath = b.create_struct_vector( path, 2 );
+
+    b.start_table();
+    b.add<std::uint64_t>( field::id, 0x0102030405060708 );
+    b.add_offset( field::name, name );
+    std::uint32_t parent = b.end_table();
+
+    point pos;
+    pos.x = 100;
+    pos.y = -200;
+
+    b.start_table();
+    b.add<std::uint64_t>( field::id, 42 );
+    b.add( field::price, 19.5 );
+    b.add_offset( field::name, name );
+    b.add_offset( field::quantities, quantities );
+    b.add_struct( field::position, pos );
+    b.add( field::color, color::blue );
+    b.add_offset( field::parent, parent );
+    b.add_offset( field::items, vitems );
+    b.add_offset( field::path, vpath );
+    std::uint32_t root = b.end_table();
+
+    b.finish( root );
+
+    return std::vector<unsigned char>( b.data(), b.data() + b.size() );
+}
+
+static void test_read( endian_table const & t )
+{
+    BOOST_TEST( t.valid() );
+
+    BOOST_TEST_EQ( t.get<std::uint64_t>( field::id ), 42u );
+    BOOST_TEST_EQ( t.get<double>( field::price ), 19.5 );
+    BOOST_TEST( t.get<color>( field::color ) == color::blue );
+
+    endian_span<char> name = t.get_string( field::name );
+    BOOST_TEST_EQ( std::string( name.begin(), name.end() ), std::string( "widget" ) );
+    BOOST_TEST_EQ( name.data()[ name.size() ], 0 );
+
+    endian_span<little_int32_buf_t> q = t.get_vector<little_int32_buf_t>( field::quantities );
+
+    if( BOOST_TEST_EQ( q.size(), 4u ) )
+    {
+        BOOST_TEST_EQ( q[ 0 ].value(), 1 );
+        BOOST_TEST_EQ( q[ 1 ].value(), -2 );
+        BOOST_TEST_EQ( q[ 2 ].value(), 300000 );
+        BOOST_TEST_EQ( q[ 3 ].value(), -4000000 );
+    }
+
+    point const * pos = t.get_struct<point>( field::position );
+
+    if( BOOST_TEST( pos != 0 ) )
+    {
+        BOOST_TEST_EQ( pos->x.value(), 100 );
+        BOOST_TEST_EQ( pos->y.value(), -200 );
+    }
+
+    endian_table parent = t.get_table( field::parent );
+
+    BOOST_TEST( parent.valid() );
+    BOOST_TEST_EQ( parent.get<std::uint64_t>( field::id ), 0x0102030405060708u );
+    BOOST_TEST_EQ( parent.get_string( field::name ).size(), 6u );
+    BOOST_TEST( !parent.has( field::price ) );
+    BOOST_TEST( !parent.get_table( field::parent ).valid() );
+
+    BOOST_TEST_EQ( t.get_vector<little_uint32_buf_t>( field::items ).size(), 3u );
+
+    for( std::size_t i = 0; i < 3; ++i )
+    {
+        endian_table item = t.get_table( field::items, i );
+
+        BOOST_TEST( item.valid() );
+        BOOST_TEST_EQ( item.get<std::uint16_t>( field::item_count ), 10 * i );
+
+        endian_span<char> s = item.get_string( field::item_name );
+        BOOST_TEST_EQ( std::string( s.begin(), s.end() ), std::string( "item" ) + static_cast<char>( '0' + i ) );
+    }
+
+    BOOST_TEST( !t.get_table( field::items, 3 ).valid() );
+
+    endian_span<point> path = t.get_vector<point>( field::path );
+
+    if( BOOST_TEST_EQ( path.size(), 2u ) )
+    {
+        BOOST_TEST_EQ( path[ 0 ].x.value(), 1 );
+        BOOST_TEST_EQ( path[ 1 ].y.value(), -4 );
+    }
+
+    // absent fields
+
+    BOOST_TEST( t.has( field::id ) );
+    BOOST_TEST( !t.has( 9 ) );
+    BOOST_TEST( !t.has( 1000 ) );
+    BOOST_TEST_EQ( t.get<std::int32_t>( 9, -7 ), -7 );
+    BOOST_TEST( t.get_vector<little_int32_buf_t>( 9 ).empty() );
+    BOOST_TEST( t.get_struct<point>( 9 ) == 0 );
+    BOOST_TEST( !t.get_table( 9 ).valid() );
+}
+
+static void test_roundtrip()
+{
+    std::vector<unsigned char> v = build_order();
+
+    test_read( endian_root_table( v.data(), v.size() ) );
+
+    // at another address
+
+    std::vector<unsigned char> w( v.size() + 1 );
+    std::memcpy( w.data() + 1, v.data(), v.size() );
+
+    test_read( endian_root_table( w.data() + 1, v.size() ) );
+}
+
+static void test_layout()
+{
+    endian_table_builder b;
+
+    b.start_table();
+    b.add<std::uint16_t>( 1, 0x1234 );
+    std::uint32_t t = b.end_table();
+    b.finish( t );
+
+    unsigned char const expected[] =
+    {
+        0x0C, 0, 0, 0,          // root offset
+        0x08, 0x00, 0x06, 0x00, // vtable: size 8, table size 6
+        0x00, 0x00, 0x04, 0x00, // field 0 absent, field 1 at 4
+        0x08, 0, 0, 0,          // table: offset to the vtable
+        0x34, 0x12,             // field 1
+    };
+
+    BOOST_TEST_EQ( b.size(), sizeof(expected) );
+    BOOST_TEST_EQ( std::memcmp( b.data(), expected, sizeof(expected) ), 0 );
+
+    endian_table r = endian_root_table( b.data(), b.size() );
+
+    BOOST_TEST_EQ( r.get<std::uint16_t>( 1 ), 0x1234 );
+
+    // reading past the end of the table yields the default
+
+    BOOST_TEST_EQ( r.get<std::uint32_t>( 1, 5 ), 5u );
+}
+
+static void test_shared_vtables()
+{
+    endian_table_builder b;
+
+    std::uint32_t t[ 2 ];
+
+    for( int i = 0; i < 2; ++i )
+    {
+        b.start_table();
+        b.add<std::int32_t>( 0, i );
+        t[ i ] = b.end_table();
+    }
+
+    std::uint32_t v = b.create_offset_vector( t, 2 );
+
+    b.start_table();
+    b.add_offset( 0, v );
+    b.finish( b.end_table() );
+
+    // all three tables have one 4-byte field at 4, and share a vtable:
+    // root offset 4, table 8, vector 12, table 8, vtable 6, table 8
+
+    BOOST_TEST_EQ( b.size(), 46u );
+
+    endian_table r = endian_root_table( b.data(), b.size() );
+
+    BOOST_TEST_EQ( r.get_table( 0, 0 ).get<std::int32_t>( 0, -1 ), 0 );
+    BOOST_TEST_EQ( r.get_table( 0, 1 ).get<std::int32_t>( 0, -1 ), 1 );
+}
+
+static void test_growth()
+{
+    endian_table_builder b( 16 );
+
+    std::vector<std::uint32_t> refs;
+
+    for( std::uint32_t i = 0; i < 1000; ++i )
+    {
+        b.start_table();
+        b.add( 0, i );
+        b.add<std::uint8_t>( 1 + i % 5, 1 );
+        refs.push_back( b.end_table() );
+    }
+
+    std::uint32_t v = b.create_offset_vector( refs.data(), refs.size() );
+
+    b.start_table();
+    b.add_offset( 0, v );
+    b.finish( b.end_table() );
+
+    endian_table r = endian_root_table( b.data(), b.size() );
+
+    for( std::uint32_t i = 0; i < 1000; ++i )
+    {
+        endian_table t = r.get_table( 0, i );
+
+        BOOST_TEST_EQ( t.get<std::uint32_t>( 0 ), i );
+        BOOST_TEST( t.has( 1 + i % 5 ) );
+        BOOST_TEST( !t.has( 1 + ( i + 1 ) % 5 ) );
+    }
+}
+
+// reads every field, for buffers that may be invalid
+
+static std::size_t read_all( endian_table const & t, int depth )
+{
+    std::size_t r = 0;
+
+    for( std::size_t f = 0; f < 10; ++f )
+    {
+        r += t.has( f );
+        r += t.get<std::uint64_t>( f ) != 0;
+        r += t.get_struct<point>( f ) != 0;
+        r += t.get_string( f ).size();
+
+        endian_span<little_int32_buf_t> v = t.get_vector<little_int32_buf_t>( f );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            r += v[ i ].value() != 0;
+        }
+
+        if( depth > 0 )
+        {
+            r += read_all( t.get_table( f ), depth - 1 );
+            r += read_all( t.get_table( f, 0 ), depth - 1 );
+        }
+    }
+
+    return r;
+}
+
+static void test_invalid()
+{
+    std::vector<unsigned char> v = build_order();
+
+    BOOST_TEST( !endian_root_table( v.data(), 3 ).valid() );
+    BOOST_TEST( !endian_table().valid() );
+    BOOST_TEST_EQ( read_all( endian_table(), 2 ), 0u );
+
+    // truncated; every access stays within the buffer
+
+    for( std::size_t n = 0; n < v.size(); ++n )
+    {
+        std::vector<unsigned char> w( v.begin(), v.begin() + n );
+        read_all( endian_root_table( w.data(), w.size() ), 2 );
+    }
+
+    // corrupted
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        std::vector<unsigned char> w( v );
+
+        w[ i ] ^= 0xFF;
+        read_all( endian_root_table( w.data(), w.size() ), 2 );
+
+        w[ i ] = 0x7F;
+        read_all( endian_root_table( w.data(), w.size() ), 2 );
+    }
+}
+
+static void test_too_large()
+{
+    {
+        endian_table_builder b;
+
+        // a table of 64 KiB
+
+        b.start_table();
+
+        for( std::size_t i = 0; i < 8191; ++i )
+        {
+            b.add<std::uint64_t>( 0, i );
+        }
+
+        b.add<std::uint32_t>( 1, 1 );
+
+        std::size_t n = b.size();
+
+        BOOST_TEST_THROWS( b.end_table(), std::length_error );
+        BOOST_TEST_EQ( b.size(), n );
+    }
+
+    {
+        endian_table_builder b;
+
+        // the largest table
+
+        b.start_table();
+
+        for( std::size_t i = 0; i < 8191; ++i )
+        {
+            b.add<std::uint64_t>( 0, i );
+        }
+
+        b.add<std::uint16_t>( 1, 1 );
+        b.add<std::uint8_t>( 2, 2 );
+
+        b.finish( b.end_table() );
+
+        endian_table t = endian_root_table( b.data(), b.size() );
+
+        BOOST_TEST( t.valid() );
+        BOOST_TEST_EQ( t.get<std::uint8_t>( 2, 0 ), 2 );
+    }
+
+    {
+        endian_table_builder b;
+
+        // a vtable of 64 KiB
+
+        b.start_table();
+        b.add<std::uint8_t>( 32765, 1 );
+
+        BOOST_TEST_THROWS( b.end_table(), std::length_error );
+
+        b.start_table();
+        b.add<std::uint8_t>( 32764, 1 );
+
+        b.finish( b.end_table() );
+
+        endian_table t = endian_root_table( b.data(), b.size() );
+
+        BOOST_TEST_EQ( t.get<std::uint8_t>( 32764, 0 ), 1 );
+    }
+}
+
+int main()
+{
+    test_roundtrip();
+    test_layout();
+    test_shared_vtables();
+    test_growth();
+    test_invalid();
+    test_too_large();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 The Boost.Endian Authors
+//
+// Distributed under the Boost Software License, Version 1.0.
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Checks that the USDT probes are present in the .note.stapsdt section
+// of the executable
+
+#include <boost/config/pragma_message.hpp>
+#include <boost/config.hpp>
+
+#if defined(__has_include)
+# if __has_include(<sys/sdt.h>) && defined(__linux__) && defined(__ELF__)
+#  define BOOST_ENDIAN_USDT_TEST_AVAILABLE
+# endif
+#endif
+
+#if !defined(BOOST_ENDIAN_USDT_TEST_AVAILABLE)
+
+BOOST_PRAGMA_MESSAGE( "Skipping test because <sys/sdt.h> is not available" )
+int main() {}
+
+#else
+
+#if !defined(BOOST_ENDIAN_ENABLE_USDT)
+# define BOOST_ENDIAN_ENABLE_USDT
+#endif
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/record.hpp>
+#include <boost/endian/shuffle.hpp>
+#include <boost/endian/pcm.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+static std::size_t occurrences( std::string const & s, std::string const & t )
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = s.find( t ); i != std::string::npos; i = s.find( t, i + 1 ) )
+    {
+        ++r;
+    }
+
+    return r;
+}
+
+int main()
+{
+    // the kernels are templates; use them, so that their probes are emitted
+
+    std::uint32_t v[ 4 ] = { 1, 2, 3, 4 };
+    unsigned char p[ 16 ];
+    unsigned char q[ 16 ];
+    float f[ 4 ];
+
+    endian_store_n<std::uint32_t, order::big>( v, 4, p );
+    endian_load_n<std::uint32_t, order::big>( p, 4, v );
+    endian_reverse_inplace_n( v, 4 );
+    endian_store_delta_n<std::uint32_t, order::big>( v, 4, 0, p );
+    endian_reverse_records_n< record_layout<2, 2> >( p, 4 );
+    byte_shuffle_n<4, order::big>( p, 4, q );
+    big_s16_to_float_n( q, 4, f );
+
+    std::ifstream is( "/proc/self/exe", std::ios_base::binary );
+    BOOST_TEST( is.good() );
+
+    std::string exe( ( std::istreambuf_iterator<char>( is ) ), std::istreambuf_iterator<char>() );
+
+    BOOST_TEST_GT( occurrences( exe, std::string( ".note.stapsdt", 14 ) ), 0u );
+
+    // each probe note contains the provider and probe names
+
+    std::size_t entries = occurrences( exe, std::string( "boost_endian\0batch_entry", 24 ) );
+    std::size_t exits = occurrences( exe, std::string( "boost_endian\0batch_exit", 23 ) );
+
+    BOOST_TEST_GE( entries, 7u );
+    BOOST_TEST_EQ( entries, exits );
+
+    return boost::report_errors();
+}
+
+#endif